@@ -0,0 +1,95 @@
+// Reading 2^20 random long longs from a file with FastInput (mmap'ed, and through the
+// read() buffer used for pipes) against ifstream >> and fscanf, and writing them with
+// FastOutput against ofstream <<.
+//
+// Build and run: make bench BENCH_ARGS=--filter=fast_io
+#include "../../tests/framework/bench_framework.hpp"
+#include "cp/core/fast_io.hpp"
+
+using namespace cp;
+
+// Writes text to a new temp file and returns its path.
+static string temp_file(const string &text)
+{
+    char path[] = "/tmp/cp_bench_fast_io_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0 || write(fd, text.data(), text.size()) != (ssize_t)text.size()) {
+        throw runtime_error("cannot write temp file");
+    }
+    close(fd);
+    return path;
+}
+
+BENCH_CASE(fast_io)
+{
+    const int n = 1 << 20;
+    const size_t page = sysconf(_SC_PAGESIZE);
+    mt19937_64 rng(48);
+    vector<ll> vals(n);
+    string text;
+    for (auto &x : vals) {
+        x = (ll)(rng() >> (rng() % 64)) - (ll)(rng() >> 2);
+        text += to_string(x) + ' ';
+    }
+    ll expect = accumulate(vals.begin(), vals.end(), 0LL, [](ll a, ll b) {
+        return (ll)((unsigned long long)a + b);
+    });
+    string mapped = text + string(page - text.size() % page > 8 ? 0 : 16, ' ');
+    string paged = text + string((page - text.size() % page) % page, ' ');
+    string mapped_path = temp_file(mapped), read_path = temp_file(paged);
+
+    auto sum_fast = [&](const string &path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        unsigned long long s = 0;
+        {
+            FastInput in(fd);
+            for (int i = 0; i < n; i++) {
+                s += in.read<ll>();
+            }
+        }
+        close(fd);
+        if ((ll)s != expect) {
+            throw runtime_error("FastInput checksum mismatch");
+        }
+    };
+    state.measure("FastInput_mmap", n, [&] { sum_fast(mapped_path); });
+    state.measure("FastInput_read", n, [&] { sum_fast(read_path); });
+    state.measure("ifstream", n, [&] {
+        ifstream f(mapped_path);
+        unsigned long long s = 0;
+        for (ll x; f >> x;) {
+            s += x;
+        }
+        if ((ll)s != expect) {
+            throw runtime_error("ifstream checksum mismatch");
+        }
+    });
+    state.measure("fscanf", n, [&] {
+        FILE *f = fopen(mapped_path.c_str(), "r");
+        unsigned long long s = 0;
+        for (ll x; fscanf(f, "%lld", &x) == 1;) {
+            s += x;
+        }
+        fclose(f);
+        if ((ll)s != expect) {
+            throw runtime_error("fscanf checksum mismatch");
+        }
+    });
+    state.measure("FastOutput", n, [&] {
+        int fd = open("/dev/null", O_WRONLY);
+        {
+            FastOutput out(fd);
+            out.write_vector(vals);
+        }
+        close(fd);
+    });
+    state.measure("ofstream", n, [&] {
+        ofstream f("/dev/null");
+        for (ll x : vals) {
+            f << x << ' ';
+        }
+        f << '\n';
+    });
+    unlink(mapped_path.c_str());
+    unlink(read_path.c_str());
+}
@@ -0,0 +1,53 @@
+// DSU and ConcurrentDSU (used from one thread) on n = 2^20: random merges into a
+// fresh structure, then random same() queries on the result.
+//
+// Build and run: make bench BENCH_ARGS=--filter=dsu
+#include "../../tests/framework/bench_framework.hpp"
+#include "cp/ds/dsu.hpp"
+
+using namespace cp;
+using cp_test::DoNotOptimize;
+
+template <typename D>
+static void run_dsu(cp_test::BenchState &state, const string &name)
+{
+    const int n = 1 << 20, q = 1 << 20;
+    mt19937 rng(41);
+    vector<pair<int, int>> merges(q), queries(q);
+    for (auto &[u, v] : merges) {
+        u = rng() % n, v = rng() % n;
+    }
+    for (auto &[u, v] : queries) {
+        u = rng() % n, v = rng() % n;
+    }
+    state.measure(name + "_merge", q, [&] {
+        D d(n);
+        for (auto [u, v] : merges) {
+            d.merge(u, v);
+        }
+        DoNotOptimize(d.find(0));
+    });
+    D d(n);
+    for (auto [u, v] : merges) {
+        d.merge(u, v);
+    }
+    if constexpr (requires { d.reset_stats(); }) { // ConcurrentDSU is not instrumented
+        d.reset_stats();
+    }
+    auto &r = state.measure(name + "_same", q, [&] {
+        int hits = 0;
+        for (auto [u, v] : queries) {
+            hits += d.same(u, v);
+        }
+        DoNotOptimize(hits);
+    });
+    if constexpr (requires { d.stats(); }) {
+        r.add_stats(d.stats());
+    }
+}
+
+BENCH_CASE(dsu)
+{
+    run_dsu<DSU>(state, "dsu");
+    run_dsu<ConcurrentDSU>(state, "concurrent_dsu");
+}
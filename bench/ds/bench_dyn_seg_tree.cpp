@@ -0,0 +1,44 @@
+// DynSegTree range adds and range sums over [0, 1e9).
+//
+// The tree never frees nodes, so every repetition replays the same operations on one
+// tree: after the warmup no new nodes are allocated and the numbers measure descent
+// through an existing sparse tree. The build measurement allocates a fresh, smaller
+// tree per repetition.
+//
+// Build and run: make bench BENCH_ARGS=--filter=dyn_seg_tree
+#include "../../tests/framework/bench_framework.hpp"
+#include "cp/ds/dyn_seg_tree.hpp"
+
+using namespace cp;
+using cp_test::DoNotOptimize;
+
+BENCH_CASE(dyn_seg_tree)
+{
+    const ll size = 1000000000;
+    const int q = 1 << 14;
+    mt19937_64 rng(41);
+    vector<array<ll, 4>> ops(q);
+    for (auto &[l1, r1, l2, r2] : ops) {
+        l1 = rng() % size, r1 = rng() % size, l2 = rng() % size, r2 = rng() % size;
+        tie(l1, r1) = minmax(l1, r1);
+        tie(l2, r2) = minmax(l2, r2);
+    }
+    state.measure("build_fresh", 1024, [&] {
+        LongDynSegTree st(size);
+        for (int i = 0; i < 1024; i++) {
+            st.update(ops[i][0], ops[i][1], 1);
+        }
+        DoNotOptimize(st.root->val);
+    });
+    LongDynSegTree st(size);
+    st.reset_stats();
+    state.measure("update_query", 2 * q, [&] {
+        ll sum = 0;
+        for (int i = 0; i < q; i++) {
+            auto [l1, r1, l2, r2] = ops[i];
+            st.update(l1, r1, i % 7);
+            sum += st.query(l2, r2);
+        }
+        DoNotOptimize(sum);
+    }).add_stats(st.stats());
+}
@@ -0,0 +1,51 @@
+// Fenwick point adds and prefix / range sums on n = 2^20.
+//
+// Build and run: make bench BENCH_ARGS=--filter=fenwick
+#include "../../tests/framework/bench_framework.hpp"
+#include "cp/ds/fenwick.hpp"
+
+using namespace cp;
+using cp_test::DoNotOptimize;
+
+BENCH_CASE(fenwick)
+{
+    const int n = 1 << 20, q = 1 << 20;
+    mt19937 rng(41);
+    vector<ll> a(n);
+    for (ll &x : a) {
+        x = rng() % 1000;
+    }
+    vector<int> idx(q), ls(q), rs(q);
+    for (int i = 0; i < q; i++) {
+        idx[i] = rng() % n;
+        ls[i] = rng() % n, rs[i] = rng() % n;
+        tie(ls[i], rs[i]) = minmax(ls[i], rs[i]);
+    }
+    state.measure("build", n, [&] {
+        Fenwick<ll> fw(a);
+        DoNotOptimize(fw.tree[n - 1]);
+    });
+    Fenwick<ll> fw(a);
+    fw.reset_stats();
+    state.measure("add", q, [&] {
+        for (int i = 0; i < q; i++) {
+            fw.add(idx[i], i);
+        }
+    }).add_stats(fw.stats());
+    fw.reset_stats();
+    state.measure("prefix_query", q, [&] {
+        ll sum = 0;
+        for (int i = 0; i < q; i++) {
+            sum += fw.query(idx[i]);
+        }
+        DoNotOptimize(sum);
+    }).add_stats(fw.stats());
+    fw.reset_stats();
+    state.measure("range_query", q, [&] {
+        ll sum = 0;
+        for (int i = 0; i < q; i++) {
+            sum += fw.query(ls[i], rs[i]);
+        }
+        DoNotOptimize(sum);
+    }).add_stats(fw.stats());
+}
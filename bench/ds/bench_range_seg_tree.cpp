@@ -0,0 +1,52 @@
+// RangeSegTree range updates and queries on n = 2^20, for an additive and an
+// assignment policy.
+//
+// Build and run: make bench BENCH_ARGS=--filter=range_seg_tree
+#include "../../tests/framework/bench_framework.hpp"
+#include "cp/ds/range_seg_tree.hpp"
+
+using namespace cp;
+using cp_test::DoNotOptimize;
+
+static vector<pair<int, int>> random_ranges(int n, int q, mt19937 &rng)
+{
+    vector<pair<int, int>> r(q);
+    for (auto &[l, h] : r) {
+        l = rng() % n, h = rng() % n;
+        if (l > h) {
+            swap(l, h);
+        }
+    }
+    return r;
+}
+
+// Interleaved update / query pairs, so lazies are pushed down by the queries.
+template <typename Policy, typename Value>
+static void run_policy(cp_test::BenchState &state, const string &name, Value value)
+{
+    const int n = 1 << 20, q = 1 << 19;
+    mt19937 rng(41);
+    auto ranges = random_ranges(n, 2 * q, rng);
+    RangeSegTree<Policy> st(vector<ll>(n, 1));
+    state.measure(name, 2 * q, [&] {
+        ll sum = 0;
+        for (int i = 0; i < q; i++) {
+            st.update(ranges[2 * i].first, ranges[2 * i].second, value(i));
+            sum += st.query(ranges[2 * i + 1].first, ranges[2 * i + 1].second);
+        }
+        DoNotOptimize(sum);
+    }).add_stats(st.stats());
+}
+
+BENCH_CASE(range_seg_tree)
+{
+    run_policy<LongSumAddPolicy>(state, "sum_add", [](int i) { return i % 7LL; });
+    run_policy<LongMinAddPolicy>(state, "min_add", [](int i) { return i % 7LL - 3; });
+    run_policy<LongSumSetPolicy>(state, "sum_set", [](int i) {
+        return optional<ll>(i);
+    });
+    run_policy<LongMinAddSetPolicy>(state, "min_add_set", [](int i) {
+        return i % 2 ? pair<ll, optional<ll>>{i % 5, nullopt}
+                     : pair<ll, optional<ll>>{0, (ll)i};
+    });
+}
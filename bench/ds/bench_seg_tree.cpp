@@ -0,0 +1,45 @@
+// SegTree<ll, plus> point updates and range queries on n = 2^20.
+//
+// Build and run: make bench BENCH_ARGS=--filter=seg_tree
+#include "../../tests/framework/bench_framework.hpp"
+#include "cp/ds/seg_tree.hpp"
+
+using namespace cp;
+using cp_test::DoNotOptimize;
+
+BENCH_CASE(seg_tree)
+{
+    const int n = 1 << 20, q = 1 << 20;
+    mt19937 rng(41);
+    vector<ll> a(n);
+    for (ll &x : a) {
+        x = rng() % 1000;
+    }
+    vector<int> idx(q), ls(q), rs(q);
+    for (int i = 0; i < q; i++) {
+        idx[i] = rng() % n;
+        ls[i] = rng() % n, rs[i] = rng() % n;
+        if (ls[i] > rs[i]) {
+            swap(ls[i], rs[i]);
+        }
+    }
+    state.measure("build", n, [&] {
+        SegTree<ll, plus<ll>{}> st(a);
+        DoNotOptimize(st.tree[1]);
+    });
+    SegTree<ll, plus<ll>{}> st(a);
+    st.reset_stats();
+    state.measure("point_update", q, [&] {
+        for (int i = 0; i < q; i++) {
+            st.update(idx[i], i);
+        }
+    }).add_stats(st.stats());
+    st.reset_stats();
+    state.measure("range_query", q, [&] {
+        ll sum = 0;
+        for (int i = 0; i < q; i++) {
+            sum += st.query(ls[i], rs[i]);
+        }
+        DoNotOptimize(sum);
+    }).add_stats(st.stats());
+}
@@ -0,0 +1,44 @@
+// Service startup: rebuilding a 2^22-element SegTree from its input against opening
+// its snapshot with and without checksum verification, then answering one query.
+//
+// Build and run: make bench BENCH_ARGS=--filter=snapshot
+#include "../../tests/framework/bench_framework.hpp"
+#include "cp/ds/snapshot.hpp"
+
+using namespace cp;
+using cp_test::DoNotOptimize;
+
+BENCH_CASE(snapshot)
+{
+    const int n = 1 << 22;
+    mt19937_64 rng(49);
+    vector<ll> a(n);
+    for (auto &x : a) {
+        x = rng() % 1000000;
+    }
+    using Tree = SegTree<ll, plus<ll>{}>;
+    using View = SegTreeView<ll, plus<ll>{}>;
+    string path = "/tmp/cp_bench_snapshot_" + to_string(getpid());
+    ll expect = 0;
+    {
+        Tree st(a);
+        expect = st.query(n / 3, n - 1);
+        if (!save_snapshot(path, st)) {
+            throw runtime_error("cannot write " + path);
+        }
+    }
+    // ops = 1: each sample is one full startup.
+    state.measure("rebuild", 1, [&] {
+        Tree st(a);
+        DoNotOptimize(st.query(n / 3, n - 1));
+    });
+    for (bool verify : {true, false}) {
+        state.measure(verify ? "open_verified" : "open", 1, [&] {
+            auto v = View::open(path, SnapshotMode::read_only, verify);
+            if (!v || v->query(n / 3, n - 1) != expect) {
+                throw runtime_error("snapshot query mismatch");
+            }
+        });
+    }
+    unlink(path.c_str());
+}
@@ -0,0 +1,55 @@
+// Static range min and range sum on n = 2^20: SparseTable, BlockSparseTable and
+// DisjointSparseTable against SegTree queries, plus each build.
+//
+// Build and run: make bench BENCH_ARGS=--filter=sparse_table
+#include "../../tests/framework/bench_framework.hpp"
+#include "cp/ds/seg_tree.hpp"
+#include "cp/ds/sparse_table.hpp"
+
+using namespace cp;
+using cp_test::DoNotOptimize;
+
+constexpr auto min_ll = [](ll a, ll b) { return min(a, b); };
+
+BENCH_CASE(sparse_table)
+{
+    const int n = 1 << 20, q = 1 << 20;
+    mt19937 rng(50);
+    vector<ll> a(n);
+    for (ll &x : a) {
+        x = rng() % 1000000;
+    }
+    vector<int> ls(q), rs(q);
+    for (int i = 0; i < q; i++) {
+        ls[i] = rng() % n, rs[i] = rng() % n;
+        if (ls[i] > rs[i]) {
+            swap(ls[i], rs[i]);
+        }
+    }
+    auto run = [&](const char *name, const auto &st) {
+        state.measure(name, q, [&] {
+            ll acc = 0;
+            for (int i = 0; i < q; i++) {
+                acc += st.query(ls[i], rs[i]);
+            }
+            DoNotOptimize(acc);
+        });
+    };
+    state.measure("build_sparse", n, [&] {
+        SparseTable<ll, min_ll> st(a);
+        DoNotOptimize(st.table[0]);
+    });
+    state.measure("build_block", n, [&] {
+        BlockSparseTable<ll> st(a);
+        DoNotOptimize(st.mask[0]);
+    });
+    state.measure("build_disjoint", n, [&] {
+        DisjointSparseTable<ll, plus<ll>{}> st(a);
+        DoNotOptimize(st.table[0]);
+    });
+    run("min_seg_tree", SegTree<ll, min_ll, INF64>(a));
+    run("min_sparse", SparseTable<ll, min_ll>(a));
+    run("min_block", BlockSparseTable<ll>(a));
+    run("sum_seg_tree", SegTree<ll, plus<ll>{}>(a));
+    run("sum_disjoint", DisjointSparseTable<ll, plus<ll>{}>(a));
+}
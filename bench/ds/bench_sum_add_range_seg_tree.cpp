@@ -0,0 +1,31 @@
+// SumAddRangeSegTree range adds and range sums on n = 2^20, the fixed-operation
+// counterpart of RangeSegTree<LongSumAddPolicy>.
+//
+// Build and run: make bench BENCH_ARGS=--filter=sum_add_range_seg_tree
+#include "../../tests/framework/bench_framework.hpp"
+#include "cp/ds/sum_add_range_seg_tree.hpp"
+
+using namespace cp;
+using cp_test::DoNotOptimize;
+
+BENCH_CASE(sum_add_range_seg_tree)
+{
+    const int n = 1 << 20, q = 1 << 19;
+    mt19937 rng(41);
+    vector<array<int, 4>> ops(q);
+    for (auto &[l1, r1, l2, r2] : ops) {
+        l1 = rng() % n, r1 = rng() % n, l2 = rng() % n, r2 = rng() % n;
+        tie(l1, r1) = minmax(l1, r1);
+        tie(l2, r2) = minmax(l2, r2);
+    }
+    LongSumAddRangeSegTree st(vector<ll>(n, 1));
+    state.measure("update_query", 2 * q, [&] {
+        ll sum = 0;
+        for (int i = 0; i < q; i++) {
+            auto [l1, r1, l2, r2] = ops[i];
+            st.update(l1, r1, i % 7);
+            sum += st.query(l2, r2);
+        }
+        DoNotOptimize(sum);
+    }).add_stats(st.stats());
+}
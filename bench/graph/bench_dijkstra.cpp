@@ -0,0 +1,114 @@
+// Dijkstra backends on a road-network-sized grid graph.
+//
+// Compares Dijkstra<DaryHeap>, Dijkstra<RadixHeap> and the textbook baseline (std::
+// priority_queue with lazy deletion and a dist array refilled every run) on
+//   - full single-source runs, and
+//   - local point-to-point queries with early exit, where the baseline's O(V) refill
+//     dominates and the engines only reset what they touched.
+//
+// Build and run: make bench BENCH_ARGS=--filter=dijkstra
+#include "../../tests/framework/bench_framework.hpp"
+#include "cp/graph/dijkstra.hpp"
+
+using namespace cp;
+
+using Graph = CSRGraph<int, ll>;
+
+// side x side grid, edges both ways with random weights in [1, 1000].
+static Graph grid_graph(int side, mt19937 &rng)
+{
+    vector<tuple<int, int, ll>> edges;
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int v = r * side + c;
+            if (c + 1 < side) {
+                edges.push_back({v, v + 1, 1 + (ll)(rng() % 1000)});
+            }
+            if (r + 1 < side) {
+                edges.push_back({v, v + side, 1 + (ll)(rng() % 1000)});
+            }
+        }
+    }
+    return Graph(side * side, edges, false);
+}
+
+// std::priority_queue with lazy deletion; dist is refilled on every call.
+static ll baseline(const Graph &g, vector<ll> &dist, int s, int t)
+{
+    dist.assign(g.n, numeric_limits<ll>::max());
+    priority_queue<pair<ll, int>, vector<pair<ll, int>>, greater<>> pq;
+    dist[s] = 0;
+    pq.push({0, s});
+    while (!pq.empty()) {
+        auto [d, v] = pq.top();
+        pq.pop();
+        if (d > dist[v]) {
+            continue;
+        }
+        if (v == t) {
+            break;
+        }
+        for (int e = g.offsets[v]; e < g.offsets[v + 1]; e++) {
+            int to = g.targets[e];
+            if (d + g.weights[e] < dist[to]) {
+                dist[to] = d + g.weights[e];
+                pq.push({dist[to], to});
+            }
+        }
+    }
+    return t == -1 ? dist[g.n - 1] : dist[t];
+}
+
+BENCH_CASE(dijkstra_grid)
+{
+    const int side = 1024, local_queries = 2000;
+    mt19937 rng(34);
+    Graph g = grid_graph(side, rng);
+    vector<pair<int, int>> local(local_queries);
+    for (auto &[s, t] : local) {
+        int r = rng() % (side - 32), c = rng() % (side - 32);
+        s = r * side + c;
+        t = (r + rng() % 32) * side + c + rng() % 32;
+    }
+
+    Dijkstra<DaryHeap<ll>> dary(g);
+    Dijkstra<RadixHeap<ll>> radix(g);
+    vector<ll> dist;
+    // every variant sums the same distances, once per call
+    ll want_full = baseline(g, dist, 0, -1), want_local = 0;
+    for (auto [s, t] : local) {
+        want_local += baseline(g, dist, s, t);
+    }
+    auto check = [](ll got, ll want) {
+        if (got != want) {
+            throw runtime_error("distance mismatch between backends");
+        }
+    };
+
+    state.measure("priority_queue_full", g.n, [&] {
+        check(baseline(g, dist, 0, -1), want_full);
+    });
+    state.measure("priority_queue_local", local_queries, [&] {
+        ll sum = 0;
+        for (auto [s, t] : local) {
+            sum += baseline(g, dist, s, t);
+        }
+        check(sum, want_local);
+    });
+    auto run = [&](const string &name, auto &sp) {
+        state.measure(name + "_full", g.n, [&] {
+            sp.run(0);
+            check(sp.dist[g.n - 1], want_full);
+        });
+        state.measure(name + "_local", local_queries, [&] {
+            ll sum = 0;
+            for (auto [s, t] : local) {
+                sp.run(s, t);
+                sum += sp.dist[t];
+            }
+            check(sum, want_local);
+        });
+    };
+    run("dary_heap", dary);
+    run("radix_heap", radix);
+}
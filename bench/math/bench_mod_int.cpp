@@ -0,0 +1,49 @@
+// ModInt<1e9+7> arithmetic: a dependent multiply-add chain (latency), independent
+// products over an array (throughput), pow and inv.
+//
+// Build and run: make bench BENCH_ARGS=--filter=mod_int
+#include "../../tests/framework/bench_framework.hpp"
+#include "cp/math/mod_int.hpp"
+
+using namespace cp;
+using cp_test::DoNotOptimize;
+
+using Mint = ModInt<MOD>;
+
+BENCH_CASE(mod_int)
+{
+    const int n = 1 << 20;
+    mt19937 rng(41);
+    vector<Mint> a(n), b(n), c(n);
+    for (int i = 0; i < n; i++) {
+        a[i] = rng(), b[i] = rng();
+    }
+    state.measure("mul_add_chain", n, [&] {
+        Mint x = 1;
+        for (int i = 0; i < n; i++) {
+            x = x * a[i] + b[i];
+        }
+        DoNotOptimize(x.val);
+    });
+    state.measure("mul_array", n, [&] {
+        for (int i = 0; i < n; i++) {
+            c[i] = a[i] * b[i];
+        }
+        DoNotOptimize(c[n - 1].val);
+    });
+    const int k = 1 << 14;
+    state.measure("pow", k, [&] {
+        int acc = 0;
+        for (int i = 0; i < k; i++) {
+            acc ^= a[i].pow(1000000000LL + i).val;
+        }
+        DoNotOptimize(acc);
+    });
+    state.measure("inv", k, [&] {
+        int acc = 0;
+        for (int i = 0; i < k; i++) {
+            acc ^= a[i].inv().val;
+        }
+        DoNotOptimize(acc);
+    });
+}
@@ -9,6 +9,10 @@ using ll = long long;
 using ull = unsigned long long;
 using ld = long double;
 
+// __extension__ silences -Wpedantic for the GCC/Clang 128-bit integer builtins.
+__extension__ typedef __int128 i128;
+__extension__ typedef unsigned __int128 u128;
+
 constexpr ll INF64 = 1e18;
 constexpr int INF = 1e9;
 constexpr int MOD = 1e9 + 7;
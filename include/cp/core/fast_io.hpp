@@ -0,0 +1,431 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cp
+{
+namespace fast_io_detail
+{
+template <typename T>
+inline constexpr bool is_int = (is_integral_v<T> && !is_same_v<T, bool> &&
+                                !is_same_v<T, char>) ||
+                               is_same_v<T, i128> || is_same_v<T, u128>;
+
+template <typename T>
+struct unsigned_of
+{
+    using type = make_unsigned_t<T>;
+};
+
+template <>
+struct unsigned_of<i128>
+{
+    using type = u128;
+};
+
+template <>
+struct unsigned_of<u128>
+{
+    using type = u128;
+};
+
+// Types such as ModInt: constructible from ll, holding their value in an integer .val.
+template <typename T>
+concept ValueWrapper = !is_int<T> && requires(T x) {
+    T(ll{});
+    requires is_int<decltype(x.val)>;
+};
+
+constexpr uint64_t ones = 0x0101010101010101ULL;
+
+// Nonzero in exactly the bytes of c that are not ASCII digits (0x80 in such a byte).
+// A byte is a digit iff its high nibble is 3 and adding 6 keeps it there.
+inline uint64_t non_digits(uint64_t c)
+{
+    uint64_t hi = c & (0xF0 * ones), hi6 = ((c + 6 * ones) & (0xF0 * ones)) >> 4;
+    uint64_t t = (hi | hi6) ^ (0x33 * ones); // zero byte iff digit
+    return ((t | ((t & (0x7F * ones)) + (0x7F * ones))) & (0x80 * ones));
+}
+
+// Value of 8 ASCII digits, first digit in the lowest byte: three multiply-add rounds
+// combine neighbours into 2-, 4-, then 8-digit groups.
+inline uint32_t parse8(uint64_t c)
+{
+    c -= 0x30 * ones;
+    c = c * 10 + (c >> 8);
+    c = (((c & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+         (((c >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+        32;
+    return (uint32_t)c;
+}
+
+inline constexpr uint32_t pow10[8] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000};
+
+inline constexpr auto digit_pairs = [] {
+    array<char, 200> t{};
+    for (int i = 0; i < 100; i++) {
+        t[2 * i] = char('0' + i / 10);
+        t[2 * i + 1] = char('0' + i % 10);
+    }
+    return t;
+}();
+} // namespace fast_io_detail
+
+// Fast whitespace-separated input from a file descriptor (stdin by default).
+//
+// A regular file is mmap'ed whole (MAP_PRIVATE, read-only) when the zero fill past its
+// end on the last page leaves at least 8 bytes, so parsing never checks bounds mid
+// token. Anything else (pipes, terminals, files whose size ends within 8 bytes of a
+// page boundary) is read() in 64 KiB blocks into a buffer kept 8 zero bytes longer
+// than its data; before an integer, it is refilled while fewer than 64 bytes are left
+// and none of them ends the token, which bounds integer tokens at 64 bytes there.
+//
+// Integers are parsed 8 bytes at a time: one load, a bit trick marking the non-digit
+// bytes, countr_zero for the digit count and three multiply-adds for the value, so
+// the digit loop has no per-digit branch on little-endian targets (a plain loop
+// otherwise). There is no overflow check. A token that does not start with a sign or
+// digit reads as T{} and is skipped whole, so has_next() loops always advance. Reads
+// past the end of input return T{}.
+//
+// Supported T: integers (including i128/u128), char (next non-space byte), string
+// (next token), and any ValueWrapper such as ModInt, built from the integer read.
+// Do not mix with cin/scanf on the same descriptor.
+//
+// Usage:
+//   FastInput in;                          // stdin
+//   int n = in.read<int>();
+//   auto a = in.read_vector<ll>(n);        // feeds SegTree(a), Fenwick(a), ...
+//   mint x; ll y; in.read(x, y);
+//   while (in.has_next()) { ... }
+//
+// Reference: http://0x80.pl/articles/swar-digits-validate.html,
+//   https://lemire.me/blog/2022/01/21/swar-explained-parsing-eight-digits/
+struct FastInput
+{
+    // O(1) time; the descriptor stays open and owned by the caller.
+    explicit FastInput(int file_descriptor = 0) : fd(file_descriptor)
+    {
+        struct stat st;
+        long page = sysconf(_SC_PAGESIZE);
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size % page != 0 &&
+            page - st.st_size % page >= (long)pad) {
+            void *m = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (m != MAP_FAILED) {
+                madvise(m, st.st_size, MADV_SEQUENTIAL);
+                mapped = (char *)m, mapped_size = st.st_size;
+                p = mapped, end = mapped + mapped_size;
+                return;
+            }
+        }
+        buf.assign(block + pad, 0);
+        p = end = buf.data();
+        refill();
+    }
+
+    FastInput(const FastInput &) = delete;
+    FastInput &operator=(const FastInput &) = delete;
+
+    ~FastInput()
+    {
+        if (mapped) {
+            munmap(mapped, mapped_size);
+        }
+    }
+
+    // True if any non-whitespace input is left; skips the whitespace before it.
+    bool has_next()
+    {
+        while (true) {
+            while (p < end && (unsigned char)*p <= ' ') {
+                p++;
+            }
+            if (p < end || !refill()) {
+                return p < end;
+            }
+        }
+    }
+
+    template <typename T>
+    T read()
+    {
+        if (!has_next()) {
+            return T{};
+        }
+        if constexpr (fast_io_detail::is_int<T>) {
+            return read_int<T>();
+        }
+        else if constexpr (is_same_v<T, char>) {
+            return *p++;
+        }
+        else if constexpr (is_same_v<T, string>) {
+            string s;
+            while (true) {
+                const char *b = p;
+                while (p < end && (unsigned char)*p > ' ') {
+                    p++;
+                }
+                s.append(b, p);
+                if (p < end || !refill()) {
+                    return s;
+                }
+            }
+        }
+        else {
+            static_assert(fast_io_detail::ValueWrapper<T>, "unsupported type");
+            return T(read_int<ll>());
+        }
+    }
+
+    template <typename... Ts>
+    void read(Ts &...xs)
+    {
+        ((xs = read<Ts>()), ...);
+    }
+
+    // n values. O(n) time.
+    template <typename T>
+    vector<T> read_vector(size_t n)
+    {
+        vector<T> v(n);
+        for (auto &x : v) {
+            x = read<T>();
+        }
+        return v;
+    }
+
+    template <typename T>
+    FastInput &operator>>(T &x)
+    {
+        x = read<T>();
+        return *this;
+    }
+
+private:
+    static constexpr size_t block = 1 << 16, pad = 8, min_ahead = 64;
+
+    int fd;
+    char *mapped = nullptr;
+    size_t mapped_size = 0;
+    vector<char> buf; // read() path: data in [p, end), then pad zero bytes
+    const char *p = nullptr, *end = nullptr;
+
+    // Moves the unread bytes to the front and reads more; false if nothing was added.
+    bool refill()
+    {
+        if (mapped) {
+            return false;
+        }
+        size_t left = end - p;
+        memmove(buf.data(), p, left);
+        ssize_t got;
+        do {
+            got = ::read(fd, buf.data() + left, block - left);
+        } while (got < 0 && errno == EINTR);
+        got = max<ssize_t>(got, 0);
+        p = buf.data(), end = p + left + got;
+        memset(buf.data() + left + got, 0, pad);
+        return got > 0;
+    }
+
+    template <typename T>
+    T read_int()
+    {
+        // A pipe may deliver a token in pieces; read on until it is terminated, without
+        // waiting for more than the token so interactive input does not block.
+        while (!mapped && end - p < (ptrdiff_t)min_ahead &&
+               none_of(p, end, [](char ch) { return (unsigned char)ch <= ' '; }) &&
+               refill()) {
+        }
+        using U = typename fast_io_detail::unsigned_of<T>::type;
+        const char *start = p;
+        bool neg = *p == '-';
+        p += neg || *p == '+';
+        U x = 0;
+        if constexpr (endian::native == endian::little) {
+            while (true) {
+                uint64_t c;
+                memcpy(&c, p, 8);
+                uint64_t nd = fast_io_detail::non_digits(c);
+                int len = nd ? countr_zero(nd) / 8 : 8;
+                if (len == 8) {
+                    x = x * 100000000 + fast_io_detail::parse8(c);
+                    p += 8;
+                    continue;
+                }
+                if (len > 0) { // right-align the digits, padding with '0' on the left
+                    int shift = 8 * (8 - len);
+                    c = (c << shift) | (0x30 * fast_io_detail::ones >> (64 - shift));
+                    x = x * U(fast_io_detail::pow10[len]) + fast_io_detail::parse8(c);
+                    p += len;
+                }
+                break;
+            }
+        }
+        else {
+            while ((unsigned)(*p - '0') < 10) {
+                x = x * 10 + (*p++ - '0');
+            }
+        }
+        if (p == start) { // not a number: skip the token instead of stalling on it
+            while (true) {
+                while (p < end && (unsigned char)*p > ' ') {
+                    p++;
+                }
+                if (p < end || !refill()) {
+                    return T{};
+                }
+            }
+        }
+        return neg ? T(U(0) - x) : T(x);
+    }
+};
+
+// Buffered output to a file descriptor (stdout by default), flushed when the 64 KiB
+// buffer fills, on flush() and on destruction.
+//
+// Integers (including i128/u128) are converted two digits per step from a 200-byte
+// digit-pair table; ValueWrappers such as ModInt print their .val. Also writes char,
+// const char * and string_view / string.
+//
+// Usage:
+//   FastOutput out;
+//   out.write(x); out.write('\n');
+//   out.println(a, b, c);                // space-separated, then newline
+//   out.write_vector(v);                 // space-separated, then newline
+struct FastOutput
+{
+    explicit FastOutput(int file_descriptor = 1) : fd(file_descriptor), buf(block) {}
+
+    FastOutput(const FastOutput &) = delete;
+    FastOutput &operator=(const FastOutput &) = delete;
+
+    ~FastOutput()
+    {
+        flush();
+    }
+
+    template <typename T>
+    void write(const T &x)
+    {
+        if constexpr (is_same_v<T, char>) {
+            reserve(1);
+            buf[len++] = x;
+        }
+        else if constexpr (fast_io_detail::is_int<T>) {
+            write_int(x);
+        }
+        else if constexpr (fast_io_detail::ValueWrapper<T>) {
+            write_int(x.val);
+        }
+        else {
+            string_view s(x);
+            if (s.size() > block) {
+                flush();
+                put(s.data(), s.size());
+                return;
+            }
+            reserve(s.size());
+            memcpy(buf.data() + len, s.data(), s.size());
+            len += s.size();
+        }
+    }
+
+    // Writes xs separated by spaces, then a newline.
+    template <typename... Ts>
+    void println(const Ts &...xs)
+    {
+        int i = 0;
+        ((i++ ? write(' ') : void(), write(xs)), ...);
+        write('\n');
+    }
+
+    // Writes the elements of v separated by sep, then a newline. O(|v|) time.
+    template <typename T>
+    void write_vector(const vector<T> &v, char sep = ' ')
+    {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) {
+                write(sep);
+            }
+            write(v[i]);
+        }
+        write('\n');
+    }
+
+    template <typename T>
+    FastOutput &operator<<(const T &x)
+    {
+        write(x);
+        return *this;
+    }
+
+    void flush()
+    {
+        put(buf.data(), len);
+        len = 0;
+    }
+
+private:
+    static constexpr size_t block = 1 << 16;
+
+    int fd;
+    vector<char> buf;
+    size_t len = 0;
+
+    void reserve(size_t k)
+    {
+        if (len + k > block) {
+            flush();
+        }
+    }
+
+    void put(const char *s, size_t n)
+    {
+        while (n > 0) {
+            ssize_t w = ::write(fd, s, n);
+            if (w < 0 && errno == EINTR) {
+                continue;
+            }
+            if (w <= 0) {
+                return; // output closed: drop the rest, as stdio would
+            }
+            s += w, n -= w;
+        }
+    }
+
+    template <typename T>
+    void write_int(T x)
+    {
+        using U = typename fast_io_detail::unsigned_of<T>::type;
+        reserve(41); // 39 digits of u128, sign
+        U u = x;
+        if constexpr (is_signed_v<T> || is_same_v<T, i128>) {
+            if (x < 0) {
+                buf[len++] = '-';
+                u = U(0) - u;
+            }
+        }
+        char tmp[40];
+        char *q = tmp + sizeof(tmp);
+        while (u >= 100) {
+            q -= 2;
+            memcpy(q, &fast_io_detail::digit_pairs[2 * (u % 100)], 2);
+            u /= 100;
+        }
+        if (u >= 10) {
+            q -= 2;
+            memcpy(q, &fast_io_detail::digit_pairs[2 * u], 2);
+        }
+        else {
+            *--q = char('0' + u);
+        }
+        size_t n = tmp + sizeof(tmp) - q;
+        memcpy(buf.data() + len, q, n);
+        len += n;
+    }
+};
+} // namespace cp
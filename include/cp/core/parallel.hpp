@@ -0,0 +1,41 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Minimal fork-join helpers over std::thread. Threads are spawned per call, so use
+// these for coarse phases (each chunk doing at least ~1e5 operations), not inner loops.
+
+// Number of hardware threads, at least 1.
+inline int hardware_threads()
+{
+    return max(1u, thread::hardware_concurrency());
+}
+
+// Splits [0, n) into `threads` contiguous chunks and runs f(begin, end, thread_id) on
+// each, one thread per chunk. threads <= 0 means hardware_threads(). With one thread
+// (or n small enough for one chunk) f runs inline on the calling thread.
+template <typename F>
+void parallel_for(int threads, ll n, F &&f)
+{
+    if (threads <= 0) {
+        threads = hardware_threads();
+    }
+    threads = (int)max(1LL, min<ll>(threads, n));
+    if (threads == 1) {
+        f(0LL, n, 0);
+        return;
+    }
+    vector<thread> pool;
+    pool.reserve(threads - 1);
+    ll chunk = (n + threads - 1) / threads;
+    for (int t = 1; t < threads; t++) {
+        ll begin = min(n, t * chunk), end = min(n, begin + chunk);
+        pool.emplace_back([&f, begin, end, t] { f(begin, end, t); });
+    }
+    f(0LL, min(n, chunk), 0);
+    for (auto &th : pool) {
+        th.join();
+    }
+}
+} // namespace cp
@@ -0,0 +1,83 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+// Hot-path instrumentation counters, compiled in only with -DCP_STATS.
+//
+// Instrumented structures hold a [[no_unique_address]] StatsCounter and bump it with
+// CP_STAT(stat.s.field++). Without CP_STATS the macro discards its argument unparsed
+// and StatsCounter is an empty member, so the structure's layout and generated code
+// are exactly those of the uninstrumented version. With it, each structure exposes
+//   Stats stats() const;   // counts since construction or the last reset_stats()
+//   void reset_stats();
+// and stats() always compiles, returning zeros when the counters are off.
+//
+// Counters are plain (non-atomic) integers: structures shared between threads are not
+// instrumented.
+//
+// Usage:
+//   make test STATS=1 / make bench STATS=1   // builds with -DCP_STATS into build/stats
+//   st.reset_stats(); ...; st.stats().lazy_pushdowns;
+#ifdef CP_STATS
+#define CP_STAT(...) (__VA_ARGS__)
+#else
+#define CP_STAT(...) ((void)0)
+#endif
+
+namespace cp
+{
+#ifdef CP_STATS
+inline constexpr bool stats_enabled = true;
+#else
+inline constexpr bool stats_enabled = false;
+#endif
+
+// One flat set of counters shared by every instrumented structure; each structure
+// fills the fields that apply to it and leaves the rest at zero.
+struct Stats
+{
+    ll node_visits = 0;    // tree nodes / Fenwick cells touched by updates and queries
+    ll pushdowns = 0;      // push_down calls
+    ll lazy_pushdowns = 0; // push_down calls that carried a non-identity lazy
+    ll allocations = 0;    // nodes allocated
+    ll finds = 0;          // DSU find calls
+    ll path_steps = 0;     // parent links followed by those finds
+
+    // Calls f(name, value) for every counter, or for none when CP_STATS is off.
+    template <typename F>
+    void each(F &&f) const
+    {
+        if constexpr (stats_enabled) {
+            f("node_visits", node_visits);
+            f("pushdowns", pushdowns);
+            f("lazy_pushdowns", lazy_pushdowns);
+            f("allocations", allocations);
+            f("finds", finds);
+            f("path_steps", path_steps);
+        }
+    }
+};
+
+struct StatsCounter
+{
+#ifdef CP_STATS
+    mutable Stats s; // mutable: const queries count too
+
+    Stats get() const
+    {
+        return s;
+    }
+
+    void reset()
+    {
+        s = {};
+    }
+#else
+    Stats get() const
+    {
+        return {};
+    }
+
+    void reset() {}
+#endif
+};
+} // namespace cp
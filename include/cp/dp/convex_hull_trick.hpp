@@ -0,0 +1,111 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Convex hull trick with a monotone deque: minimum of lines y = k x + b, for lines
+// added in non-increasing slope order.
+//
+// With slopes sorted, each new line can only make lines at the back of the lower
+// envelope useless, so the envelope is a flat array with a head index: add_line pops
+// from the back, query_monotone pops from the front. For maximum, add (-k, -b) and
+// negate the result.
+//
+// Intersections are compared by cross-multiplication, with every difference and
+// product in i128 for integer T: no division, and exact for any ll b as long as
+// |k| <= 2^62 (so each product fits in i128). k * x + b must fit in T.
+//
+// Typical use, dp[i] = min over j < i of dp[j] + a[j] * x[i] + c[j]:
+//   MonotoneCHT<ll> cht;
+//   cht.add_line(a[0], dp[0] + c[0]);
+//   for i: dp[i] = cht.query(x[i]); cht.add_line(a[i], dp[i] + c[i]);
+//
+// Reference: https://cp-algorithms.com/geometry/convex_hull_trick.html
+template <typename T>
+struct MonotoneCHT
+{
+    struct Line
+    {
+        T k, b;
+
+        T eval(T x) const
+        {
+            return k * x + b;
+        }
+    };
+
+    vector<Line> lines; // lines[head..] is the lower envelope, slopes decreasing
+    int head = 0;
+
+    int size() const
+    {
+        return lines.size() - head;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    // Adds y = k x + b. k must not exceed the slope of any earlier line.
+    // O(1) amortized time.
+    void add_line(T k, T b)
+    {
+        assert(empty() || k <= lines.back().k);
+        if (!empty() && lines.back().k == k) {
+            if (lines.back().b <= b) {
+                return;
+            }
+            lines.pop_back();
+        }
+        Line l{k, b};
+        while (size() >= 2 && useless(lines[lines.size() - 2], lines.back(), l)) {
+            lines.pop_back();
+        }
+        lines.push_back(l);
+    }
+
+    // Minimum over the envelope at x, by binary search. O(log n) time.
+    T query(T x) const
+    {
+        assert(!empty());
+        int lo = head, hi = lines.size() - 1;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (lines[mid].eval(x) >= lines[mid + 1].eval(x)) {
+                lo = mid + 1;
+            }
+            else {
+                hi = mid;
+            }
+        }
+        return lines[lo].eval(x);
+    }
+
+    // Minimum at x, for x non-decreasing across calls. Lines that are no longer
+    // optimal for any later x are dropped from the front, so later query(x) calls are
+    // only valid for x at least as large. O(1) amortized time.
+    T query_monotone(T x)
+    {
+        assert(!empty());
+        while (size() >= 2 && lines[head + 1].eval(x) <= lines[head].eval(x)) {
+            head++;
+        }
+        return lines[head].eval(x);
+    }
+
+private:
+    // b is useless if a and c cross at or left of where a and b cross.
+    static bool useless(const Line &a, const Line &b, const Line &c)
+    {
+        if constexpr (is_integral_v<T>) {
+            // Widen before subtracting: c.b - a.b alone can overflow T.
+            return ((i128)c.b - a.b) * ((i128)a.k - b.k) <=
+                   ((i128)b.b - a.b) * ((i128)a.k - c.k);
+        }
+        else {
+            return (ld)(c.b - a.b) * (a.k - b.k) <= (ld)(b.b - a.b) * (a.k - c.k);
+        }
+    }
+};
+} // namespace cp
@@ -0,0 +1,79 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Divide-and-conquer DP optimization.
+//
+// divide_conquer_step computes, for every i in [0, n),
+//   best[i] = min over 0 <= j <= i of f(j, i)
+// when the smallest minimizing j, opt(i), is non-decreasing in i (which holds when the
+// cost in f satisfies the quadrangle inequality). The middle row is solved by a scan
+// over its allowed range of j, which then splits the candidates for the rows above and
+// below it, so every level of the recursion scans O(n) candidates: O(n log n) calls to
+// f in total instead of O(n^2). The recursion is an explicit stack of row ranges.
+//
+// f is the whole transition, typically prev[j] + cost(j, i). It may return
+// numeric_limits<T>::max() for disallowed transitions, such as empty segments (j == i)
+// or j below a fixed bound; rows with no allowed j get that value.
+//
+// Usage:
+//   auto f = [&](int j, int i) { return prev[j] + cost(j, i); };
+//   divide_conquer_step<ll>(n, f, cur);
+//   partition_dp<ll>(n, k, cost);   // cost(l, r) of the segment [l, r)
+//
+// Reference: https://cp-algorithms.com/dynamic_programming/divide-and-conquer-dp.html
+template <typename T, typename F>
+void divide_conquer_step(int n, F &&f, span<T> best, span<int> arg = {})
+{
+    assert((int)best.size() >= n && (arg.empty() || (int)arg.size() >= n));
+    // (row range l..r, candidate range optl..optr)
+    vector<array<int, 4>> stack;
+    if (n > 0) {
+        stack.push_back({0, n - 1, 0, n - 1});
+    }
+    while (!stack.empty()) {
+        auto [l, r, optl, optr] = stack.back();
+        stack.pop_back();
+        int mid = l + (r - l) / 2, opt = optl;
+        T val = numeric_limits<T>::max();
+        for (int j = optl; j <= min(mid, optr); j++) {
+            T cand = f(j, mid);
+            if (cand < val) {
+                val = cand, opt = j;
+            }
+        }
+        best[mid] = val;
+        if (!arg.empty()) {
+            arg[mid] = opt;
+        }
+        if (l < mid) {
+            stack.push_back({l, mid - 1, optl, opt});
+        }
+        if (mid < r) {
+            stack.push_back({mid + 1, r, opt, optr});
+        }
+    }
+}
+
+// Minimum total cost of splitting [0, n) into exactly k non-empty consecutive segments,
+// where cost(l, r) is the cost of segment [l, r) and satisfies the quadrangle
+// inequality. k layers of divide_conquer_step: O(k n log n) time, O(n) space.
+template <typename T, typename Cost>
+T partition_dp(int n, int k, Cost &&cost)
+{
+    assert(k >= 1 && k <= n);
+    constexpr T none = numeric_limits<T>::max();
+    // prev[i] = best split of the prefix [0, i) into the current number of segments
+    vector<T> prev(n + 1, none), cur(n + 1);
+    prev[0] = 0;
+    for (int layer = 0; layer < k; layer++) {
+        auto f = [&](int j, int i) {
+            return j == i || prev[j] == none ? none : prev[j] + cost(j, i);
+        };
+        divide_conquer_step<T>(n + 1, f, span<T>(cur));
+        swap(prev, cur);
+    }
+    return prev[n];
+}
+} // namespace cp
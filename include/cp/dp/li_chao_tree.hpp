@@ -0,0 +1,205 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Line y = k x + b stored in Li Chao tree nodes. The default is the empty line, which
+// never wins a minimum.
+template <typename T>
+struct LiChaoLine
+{
+    T k = 0, b = numeric_limits<T>::max();
+
+    T eval(T x) const
+    {
+        return k * x + b;
+    }
+};
+
+// Li Chao tree: insert lines (or line segments) y = k x + b in any order and query
+// the minimum at a point. For maximum, insert (-k, -b) and negate the result.
+//
+// Every node keeps the line that is lowest at its midpoint; a new line loses to it
+// on one half at most, and only that half is descended into. Insertion and query
+// are loops, not recursion.
+//
+// LiChaoTree is array-backed over a fixed set of query coordinates xs, given up front
+// (sorted, distinct): node v of a perfect binary tree covers a power-of-two block of
+// xs indices, so the tree is one flat vector of 2 * size lines and a query walks from
+// its leaf to the root. DynLiChaoTree below covers a whole integer range instead.
+//
+// Empty nodes hold k = 0, b = numeric_limits<T>::max(), so a query with no lines
+// returns that value. k * x + b must fit in T.
+//
+// Usage:
+//   LiChaoTree<ll> lc(xs);
+//   lc.add_line(k, b);
+//   lc.add_segment(k, b, x1, x2);  // only over x1 <= x <= x2
+//   lc.query(xs[i]);
+//
+// Reference: https://cp-algorithms.com/geometry/convex_hull_trick.html#li-chao-tree
+template <typename T>
+struct LiChaoTree
+{
+    using Line = LiChaoLine<T>;
+
+    int n, size;
+    vector<T> xs; // padded to size with xs.back()
+    vector<Line> tree;
+
+    // O(n) time, O(n) space. xs must be sorted and distinct.
+    LiChaoTree(const vector<T> &coords) : n(coords.size()), xs(coords)
+    {
+        assert(n >= 1 && is_sorted(xs.begin(), xs.end()));
+        size = bit_ceil((unsigned)n);
+        xs.resize(size, xs.back());
+        tree.resize(2 * size);
+    }
+
+    // Adds y = k x + b everywhere. O(log n) time.
+    void add_line(T k, T b)
+    {
+        descend(1, {k, b});
+    }
+
+    // Adds y = k x + b on x1 <= x <= x2 only. O(log^2 n) time.
+    void add_segment(T k, T b, T x1, T x2)
+    {
+        int l = lower_bound(xs.begin(), xs.begin() + n, x1) - xs.begin();
+        int r = upper_bound(xs.begin(), xs.begin() + n, x2) - xs.begin();
+        for (l += size, r += size; l < r; l >>= 1, r >>= 1) {
+            if (l & 1) {
+                descend(l++, {k, b});
+            }
+            if (r & 1) {
+                descend(--r, {k, b});
+            }
+        }
+    }
+
+    // Minimum at x, which must be one of the coordinates. O(log n) time.
+    T query(T x) const
+    {
+        int i = lower_bound(xs.begin(), xs.begin() + n, x) - xs.begin();
+        assert(i < n && xs[i] == x);
+        T res = numeric_limits<T>::max();
+        for (int v = i + size; v >= 1; v >>= 1) {
+            res = min(res, tree[v].eval(x));
+        }
+        return res;
+    }
+
+private:
+    // Pushes line f into the subtree of v.
+    void descend(int v, Line f)
+    {
+        int depth = bit_width((unsigned)v) - 1, width = size >> depth;
+        int l = (v - (1 << depth)) * width, r = l + width - 1;
+        while (true) {
+            int m = l + (r - l) / 2;
+            Line &cur = tree[v];
+            if (f.eval(xs[m]) < cur.eval(xs[m])) {
+                swap(f, cur);
+            }
+            if (l == r) {
+                return;
+            }
+            if (f.eval(xs[l]) < cur.eval(xs[l])) {
+                v = 2 * v, r = m;
+            }
+            else if (f.eval(xs[r]) < cur.eval(xs[r])) {
+                v = 2 * v + 1, l = m + 1;
+            }
+            else {
+                return;
+            }
+        }
+    }
+};
+
+// Li Chao tree over every integer x in [lo, hi], with nodes created on demand.
+//
+// Nodes live in one arena vector and refer to their children by int index (-1 for
+// none) rather than by pointer, so the whole tree is a single allocation that grows
+// geometrically and is freed with the object. A line that reaches a missing child
+// simply becomes that child, so each add_line creates at most one node and q lines
+// use at most q + 1 nodes, independent of hi - lo.
+//
+// Usage:
+//   DynLiChaoTree<ll> lc(-1e9, 1e9);
+//   lc.add_line(k, b);
+//   lc.query(x);
+template <typename T>
+struct DynLiChaoTree
+{
+    using Line = LiChaoLine<T>;
+
+    struct Node
+    {
+        Line line;
+        int left = -1, right = -1;
+    };
+
+    ll lo, hi;
+    vector<Node> nodes; // nodes[0] is the root
+
+    // O(1) time, O(1) space.
+    DynLiChaoTree(ll l, ll r) : lo(l), hi(r), nodes(1)
+    {
+        assert(l <= r);
+    }
+
+    // Adds y = k x + b. O(log(hi - lo)) time, O(1) amortized space.
+    void add_line(T k, T b)
+    {
+        Line f{k, b};
+        ll l = lo, r = hi;
+        for (int v = 0;;) {
+            ll m = l + (r - l) / 2; // avoids overflow vs (l + r) / 2
+            if (f.eval(m) < nodes[v].line.eval(m)) {
+                swap(f, nodes[v].line);
+            }
+            if (l == r) {
+                return;
+            }
+            bool go_left = f.eval(l) < nodes[v].line.eval(l);
+            if (!go_left && !(f.eval(r) < nodes[v].line.eval(r))) {
+                return;
+            }
+            int child = go_left ? nodes[v].left : nodes[v].right;
+            if (child == -1) {
+                child = nodes.size();
+                (go_left ? nodes[v].left : nodes[v].right) = child;
+                nodes.push_back({f, -1, -1}); // an empty subtree takes f as is
+                return;
+            }
+            v = child;
+            if (go_left) {
+                r = m;
+            }
+            else {
+                l = m + 1;
+            }
+        }
+    }
+
+    // Minimum at x. O(log(hi - lo)) time.
+    T query(ll x) const
+    {
+        assert(x >= lo && x <= hi);
+        T res = numeric_limits<T>::max();
+        ll l = lo, r = hi;
+        for (int v = 0; v != -1;) {
+            res = min(res, nodes[v].line.eval(x));
+            ll m = l + (r - l) / 2;
+            if (x <= m) {
+                v = nodes[v].left, r = m;
+            }
+            else {
+                v = nodes[v].right, l = m + 1;
+            }
+        }
+        return res;
+    }
+};
+} // namespace cp
@@ -1,5 +1,6 @@
 #pragma once
 #include "cp/core/common.hpp"
+#include "cp/core/stats.hpp"
 
 namespace cp
 {
@@ -13,6 +14,7 @@ struct DSU
     int n;
     vector<int> parents;
     vector<int> sizes;
+    [[no_unique_address]] StatsCounter stat; // finds, path_steps
 
     // O(n) time, O(n) space.
     DSU(int size) : n(size), parents(size), sizes(size, 1)
@@ -23,7 +25,8 @@ struct DSU
     // Returns the root of u's set. O(a(n)) amortized.
     int find(int u)
     {
-        return u == parents[u] ? u : (parents[u] = find(parents[u]));
+        CP_STAT(stat.s.finds++);
+        return find_root(u);
     }
 
     // Returns true if u and v are in the same set. O(a(n)) amortized.
@@ -46,5 +49,102 @@ struct DSU
         parents[v] = u;
         sizes[u] += sizes[v];
     }
+
+    // Hot-path counters (cp/core/stats.hpp); all zero unless built with CP_STATS.
+    Stats stats() const
+    {
+        return stat.get();
+    }
+
+    void reset_stats()
+    {
+        stat.reset();
+    }
+
+private:
+    int find_root(int u)
+    {
+        if (u == parents[u]) {
+            return u;
+        }
+        CP_STAT(stat.s.path_steps++);
+        return parents[u] = find_root(parents[u]);
+    }
+};
+
+// Lock-free DSU for concurrent merge/find from many threads.
+//
+// Roots are linked by index (the larger root goes under the smaller one) instead of by
+// size, so parents[u] <= u always holds and no interleaving of CAS operations can form
+// a cycle. find uses path halving: each hop tries to CAS the node's parent to its
+// grandparent, and a lost race only means that hop was not shortened. Without union by
+// size the bound is O(log n) amortized per operation rather than O(a(n)).
+//
+// Reference: Anderson, Woll - "Wait-free parallel algorithms for the union-find
+// problem" (1991)
+struct ConcurrentDSU
+{
+    int n;
+    vector<atomic<int>> parents;
+
+    // O(n) time, O(n) space.
+    ConcurrentDSU(int size) : n(size), parents(size)
+    {
+        for (int i = 0; i < n; i++) {
+            parents[i].store(i, memory_order_relaxed);
+        }
+    }
+
+    // Returns the current root of u's set. Thread-safe.
+    int find(int u)
+    {
+        while (true) {
+            int p = parents[u].load(memory_order_relaxed);
+            if (p == u) {
+                return u;
+            }
+            int gp = parents[p].load(memory_order_relaxed);
+            if (p != gp) {
+                parents[u].compare_exchange_weak(p, gp, memory_order_relaxed);
+            }
+            u = gp;
+        }
+    }
+
+    // Returns true if u and v are in the same set. Thread-safe; the answer is exact
+    // only if no concurrent merge touches either set.
+    bool same(int u, int v)
+    {
+        while (true) {
+            u = find(u);
+            v = find(v);
+            if (u == v) {
+                return true;
+            }
+            if (parents[u].load() == u) {
+                return false;
+            }
+        }
+    }
+
+    // Merges the sets containing u and v. Returns true if this call performed the
+    // merge, false if they were already in one set. Thread-safe.
+    bool merge(int u, int v)
+    {
+        while (true) {
+            u = find(u);
+            v = find(v);
+            if (u == v) {
+                return false;
+            }
+            if (u < v) {
+                swap(u, v);
+            }
+            int expected = u;
+            if (parents[u].compare_exchange_strong(expected, v)) {
+                return true;
+            }
+        }
+    }
 };
 } // namespace cp
@@ -1,5 +1,6 @@
 #pragma once
 #include "cp/core/common.hpp"
+#include "cp/core/stats.hpp"
 
 namespace cp
 {
@@ -30,16 +31,20 @@ struct DynSegTree
 
     ll lo, hi;
     Node *root;
+    [[no_unique_address]] StatsCounter stat; // node_visits, pushdowns, lazy_pushdowns,
+                                             // allocations
 
     // O(1) time, O(1) space.
     DynSegTree(ll size) : lo(0), hi(size - 1), root(new Node())
     {
+        CP_STAT(stat.s.allocations++);
         assert(size > 0);
     }
 
     // O(1) time, O(1) space.
     DynSegTree(ll l, ll r) : lo(l), hi(r), root(new Node())
     {
+        CP_STAT(stat.s.allocations++);
         assert(l <= r);
     }
 
@@ -57,20 +62,35 @@ struct DynSegTree
         return query(root, lo, hi, l, r);
     }
 
+    // Hot-path counters (cp/core/stats.hpp); all zero unless built with CP_STATS.
+    Stats stats() const
+    {
+        return stat.get();
+    }
+
+    void reset_stats()
+    {
+        stat.reset();
+    }
+
 private:
     // Pushes lazy down to children, creating them if needed.
     void push_down(Node *node, ll tl, ll tr)
     {
         assert(tl < tr); // cannot apply to leaves
+        CP_STAT(stat.s.pushdowns++);
         if (!node->left) {
             node->left = new Node();
+            CP_STAT(stat.s.allocations++);
         }
         if (!node->right) {
             node->right = new Node();
+            CP_STAT(stat.s.allocations++);
         }
         if (node->lazy == T{}) {
             return;
         }
+        CP_STAT(stat.s.lazy_pushdowns++);
         ll mid = tl + (tr - tl) / 2; // avoids overflow vs (tl + tr) / 2
         node->left->val += node->lazy * (mid - tl + 1);
         node->left->lazy += node->lazy;
@@ -81,6 +101,7 @@ private:
 
     void update(Node *node, ll tl, ll tr, ll l, ll r, T val)
     {
+        CP_STAT(stat.s.node_visits++);
         if (r < tl || tr < l) {
             return;
         }
@@ -107,7 +128,11 @@ private:
     // term above them.
     T query(const Node *node, ll tl, ll tr, ll l, ll r) const
     {
-        if (!node || r < tl || tr < l) {
+        if (!node) {
+            return T{};
+        }
+        CP_STAT(stat.s.node_visits++);
+        if (r < tl || tr < l) {
             return T{};
         }
         if (l <= tl && tr <= r) {
@@ -1,5 +1,6 @@
 #pragma once
 #include "cp/core/common.hpp"
+#include "cp/core/stats.hpp"
 
 namespace cp
 {
@@ -12,6 +13,7 @@ struct Fenwick
 {
     int n;
     vector<T> tree;
+    [[no_unique_address]] StatsCounter stat; // node_visits (cells touched)
 
     // O(n) time, O(n) space.
     Fenwick(int size) : n(size), tree(size) {}
@@ -28,6 +30,7 @@ struct Fenwick
     void add(int idx, T delta)
     {
         for (; idx < n; idx = idx | (idx + 1)) {
+            CP_STAT(stat.s.node_visits++);
             tree[idx] += delta;
         }
     }
@@ -37,6 +40,7 @@ struct Fenwick
     {
         T result{};
         for (; r >= 0; r = (r & (r + 1)) - 1) {
+            CP_STAT(stat.s.node_visits++);
             result += tree[r];
         }
         return result;
@@ -47,6 +51,17 @@ struct Fenwick
     {
         return query(r) - query(l - 1);
     }
+
+    // Hot-path counters (cp/core/stats.hpp); all zero unless built with CP_STATS.
+    Stats stats() const
+    {
+        return stat.get();
+    }
+
+    void reset_stats()
+    {
+        stat.reset();
+    }
 };
 
 // Fenwick tree over an arbitrary index range [l, r].
@@ -1,5 +1,6 @@
 #pragma once
 #include "cp/core/common.hpp"
+#include "cp/core/stats.hpp"
 
 namespace cp
 {
@@ -47,6 +48,7 @@ struct RangeSegTree
     int n;
     vector<T> tree;
     vector<L> lazy;
+    [[no_unique_address]] StatsCounter stat; // node_visits, pushdowns, lazy_pushdowns
 
     // O(n) time, O(n) space.
     RangeSegTree(int size)
@@ -81,6 +83,17 @@ struct RangeSegTree
         return query(1, 0, n - 1, l, r);
     }
 
+    // Hot-path counters (cp/core/stats.hpp); all zero unless built with CP_STATS.
+    Stats stats() const
+    {
+        return stat.get();
+    }
+
+    void reset_stats()
+    {
+        stat.reset();
+    }
+
 private:
     void build(int v, int tl, int tr, const vector<T> &a)
     {
@@ -100,9 +113,11 @@ private:
     void push_down(int v, int tl, int tr)
     {
         assert(tl < tr);
+        CP_STAT(stat.s.pushdowns++);
         if (lazy[v] == Policy::lazy_init) {
             return;
         }
+        CP_STAT(stat.s.lazy_pushdowns++);
         int mid = tl + (tr - tl) / 2;
         tree[2 * v] = Policy::apply(tree[2 * v], lazy[v], mid - tl + 1);
         lazy[2 * v] = Policy::merge(lazy[2 * v], lazy[v]);
@@ -118,6 +133,7 @@ private:
     // produce T values; updates apply L actions.
     void update(int v, int tl, int tr, int l, int r, L val)
     {
+        CP_STAT(stat.s.node_visits++);
         if (r < tl || tr < l) {
             return;
         }
@@ -135,6 +151,7 @@ private:
 
     T query(int v, int tl, int tr, int l, int r)
     {
+        CP_STAT(stat.s.node_visits++);
         if (r < tl || tr < l) {
             return Policy::query_oob;
         }
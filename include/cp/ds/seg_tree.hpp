@@ -1,5 +1,6 @@
 #pragma once
 #include "cp/core/common.hpp"
+#include "cp/core/stats.hpp"
 
 namespace cp
 {
@@ -23,6 +24,7 @@ struct SegTree
 {
     int n;
     vector<T> tree;
+    [[no_unique_address]] StatsCounter stat; // node_visits
 
     // O(n) time, O(n) space.
     SegTree(int size) : n(size), tree(4 * size, T{}) {}
@@ -47,6 +49,17 @@ struct SegTree
         return query(1, 0, n - 1, l, r);
     }
 
+    // Hot-path counters (cp/core/stats.hpp); all zero unless built with CP_STATS.
+    Stats stats() const
+    {
+        return stat.get();
+    }
+
+    void reset_stats()
+    {
+        stat.reset();
+    }
+
 private:
     void build(int v, int tl, int tr, const vector<T> &a)
     {
@@ -62,6 +75,7 @@ private:
 
     void update(int v, int tl, int tr, int idx, T val)
     {
+        CP_STAT(stat.s.node_visits++);
         if (tl == tr) {
             tree[v] = val;
             return;
@@ -78,6 +92,7 @@ private:
 
     T query(int v, int tl, int tr, int l, int r) const
     {
+        CP_STAT(stat.s.node_visits++);
         if (r < tl || tr < l) {
             return identity;
         }
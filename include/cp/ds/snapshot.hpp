@@ -0,0 +1,713 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include "cp/ds/dsu.hpp"
+#include "cp/ds/fenwick.hpp"
+#include "cp/ds/range_seg_tree.hpp"
+#include "cp/ds/seg_tree.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cp
+{
+// Binary snapshots of built SegTree, RangeSegTree, Fenwick and DSU, loaded by mmap and
+// queried in place without copying or rebuilding.
+//
+// File layout (native byte order, checked on load):
+//   [0, 128)   SnapshotHeader: magic, version, structure kind, sizeof the value (and
+//              lazy) type, n, file size, checksum, and {offset, count} per array
+//   [128, ..)  the structure's arrays in member order, each starting on a 64-byte
+//              boundary and zero-padded to one
+// The arrays are the structure's vectors byte for byte, so the element types must be
+// trivially copyable in practice (trivially copy-constructible and destructible). The
+// checksum is a 4-lane multiply-rotate hash over every 8-byte word after the header:
+// it catches truncation and corruption, it is not cryptographic.
+//
+// Loading validates the header and array bounds in O(1); verify = true also checks the
+// checksum, which reads the whole file once. Without it, opening costs a few syscalls
+// and each query faults in only the pages it touches.
+//   SnapshotMode::read_only       MAP_SHARED, PROT_READ - the page cache is shared by
+//                                 every process mapping the file; views are query-only
+//   SnapshotMode::copy_on_write   MAP_PRIVATE, writable - updates go to private copies
+//                                 of the touched pages and never reach the file
+// Failures (missing file, wrong kind or element size, bad checksum, ...) return false
+// or nullopt with the reason in *why; the library does not throw. The loader cannot
+// see combine or Policy: open a snapshot with the same template arguments it was
+// saved with.
+//
+// Usage:
+//   SegTree<ll, plus<ll>{}> st(a);
+//   save_snapshot("st.snap", st);
+//   // later, possibly in another process:
+//   auto v = SegTreeView<ll, plus<ll>{}>::open("st.snap");
+//   if (v) v->query(l, r);                   // same answers as st.query(l, r)
+//   auto f = FenwickView<ll>::open("fw.snap", SnapshotMode::copy_on_write);
+//   f->add(i, delta);
+enum class SnapshotKind : uint32_t
+{
+    seg_tree = 1,
+    range_seg_tree = 2,
+    fenwick = 3,
+    dsu = 4,
+};
+
+enum class SnapshotMode
+{
+    read_only,
+    copy_on_write,
+};
+
+inline constexpr uint32_t snapshot_version = 1;
+
+struct SnapshotArray
+{
+    uint64_t offset; // from the start of the file, a multiple of 64
+    uint64_t count;  // elements
+};
+
+struct SnapshotHeader
+{
+    char magic[8];       // "CPSNAP\r\n"
+    uint32_t version;    // snapshot_version
+    uint32_t kind;       // SnapshotKind
+    uint32_t value_size; // sizeof(T); sizeof(int) for DSU
+    uint32_t lazy_size;  // sizeof(Policy::L) for RangeSegTree, else 0
+    int64_t n;
+    uint64_t file_size;
+    uint64_t checksum; // over [sizeof(SnapshotHeader), file_size)
+    uint32_t array_count;
+    uint32_t byte_order; // 0x01020304 as written by the saving machine
+    SnapshotArray arrays[4];
+    uint64_t reserved[1];
+};
+static_assert(sizeof(SnapshotHeader) == 128);
+
+namespace snapshot_detail
+{
+constexpr char magic[8] = {'C', 'P', 'S', 'N', 'A', 'P', '\r', '\n'};
+constexpr uint64_t align = 64, byte_order = 0x01020304;
+
+template <typename T>
+concept Storable =
+    is_trivially_copy_constructible_v<T> && is_trivially_destructible_v<T>;
+
+inline uint64_t round_up(uint64_t x)
+{
+    return (x + align - 1) / align * align;
+}
+
+// {count, element size} of each array of a structure of the given kind and size.
+inline vector<pair<uint64_t, uint64_t>> layout(SnapshotKind kind,
+                                               uint64_t n,
+                                               uint64_t value_size,
+                                               uint64_t lazy_size)
+{
+    switch (kind) {
+    case SnapshotKind::seg_tree:
+        return {{4 * n, value_size}};
+    case SnapshotKind::range_seg_tree:
+        return {{4 * n, value_size}, {4 * n, lazy_size}};
+    case SnapshotKind::fenwick:
+        return {{n, value_size}};
+    case SnapshotKind::dsu:
+        return {{n, sizeof(int)}, {n, sizeof(int)}};
+    }
+    return {};
+}
+
+// Four independent multiply-rotate lanes over 8-byte words, 64 bytes per step.
+struct Checksum
+{
+    uint64_t lane[4] = {0x243F6A8885A308D3ULL,
+                        0x13198A2E03707344ULL,
+                        0xA4093822299F31D0ULL,
+                        0x082EFA98EC4E6C89ULL};
+
+    void add_block(const char *p)
+    {
+        for (int j = 0; j < 8; j++) {
+            uint64_t w;
+            memcpy(&w, p + 8 * j, 8);
+            uint64_t &h = lane[j & 3];
+            h = rotl((h ^ w) * 0x9E3779B97F4A7C15ULL, 31);
+        }
+    }
+
+    // Adds bytes bytes of p, zero-padded to a multiple of 64.
+    void add(const char *p, uint64_t bytes)
+    {
+        uint64_t full = bytes / align * align;
+        for (uint64_t i = 0; i < full; i += align) {
+            add_block(p + i);
+        }
+        if (full < bytes) {
+            char tail[align] = {};
+            memcpy(tail, p + full, bytes - full);
+            add_block(tail);
+        }
+    }
+
+    uint64_t value(uint64_t file_size) const
+    {
+        uint64_t h = file_size;
+        for (uint64_t x : lane) {
+            h = rotl(h ^ x, 23) * 0xFF51AFD7ED558CCDULL;
+        }
+        return h ^ (h >> 33);
+    }
+};
+
+inline bool fail(string *why, const string &reason)
+{
+    if (why) {
+        *why = reason;
+    }
+    return false;
+}
+
+struct ArrayRef
+{
+    const void *data;
+    uint64_t count, elem_size;
+};
+
+// Writes path + ".tmp" and renames it over path, so a reader never maps a partial file.
+inline bool write(const string &path,
+                  SnapshotKind kind,
+                  int64_t n,
+                  uint32_t value_size,
+                  uint32_t lazy_size,
+                  const vector<ArrayRef> &arrays,
+                  string *why)
+{
+    SnapshotHeader h{};
+    memcpy(h.magic, magic, sizeof(magic));
+    h.version = snapshot_version;
+    h.kind = (uint32_t)kind;
+    h.value_size = value_size;
+    h.lazy_size = lazy_size;
+    h.n = n;
+    h.array_count = arrays.size();
+    h.byte_order = byte_order;
+    Checksum sum;
+    uint64_t offset = sizeof(SnapshotHeader);
+    for (size_t i = 0; i < arrays.size(); i++) {
+        uint64_t bytes = arrays[i].count * arrays[i].elem_size;
+        h.arrays[i] = {offset, arrays[i].count};
+        sum.add((const char *)arrays[i].data, bytes);
+        offset += round_up(bytes);
+    }
+    h.file_size = offset;
+    h.checksum = sum.value(offset);
+
+    string tmp = path + ".tmp";
+    FILE *f = fopen(tmp.c_str(), "wb");
+    if (!f) {
+        return fail(why, "cannot create " + tmp + ": " + strerror(errno));
+    }
+    bool ok = fwrite(&h, sizeof(h), 1, f) == 1;
+    for (auto &a : arrays) {
+        uint64_t bytes = a.count * a.elem_size;
+        static constexpr char zeros[align] = {};
+        uint64_t padding = round_up(bytes) - bytes;
+        ok = ok && fwrite(a.data, 1, bytes, f) == bytes;
+        ok = ok && fwrite(zeros, 1, padding, f) == padding;
+    }
+    ok = fclose(f) == 0 && ok;
+    if (!ok || rename(tmp.c_str(), path.c_str()) != 0) {
+        string reason = strerror(errno);
+        unlink(tmp.c_str());
+        return fail(why, "cannot write " + path + ": " + reason);
+    }
+    return true;
+}
+} // namespace snapshot_detail
+
+// A mapped, validated snapshot file. Move-only; unmaps on destruction, so views into
+// its arrays must not outlive it (the *View types below own theirs).
+struct Snapshot
+{
+    // Maps path and checks that it holds a structure of the given kind and element
+    // sizes. O(1) time, plus O(file size) with verify.
+    static optional<Snapshot> open(const string &path,
+                                   SnapshotKind kind,
+                                   uint32_t value_size,
+                                   uint32_t lazy_size,
+                                   SnapshotMode mode = SnapshotMode::read_only,
+                                   bool verify = true,
+                                   string *why = nullptr)
+    {
+        using namespace snapshot_detail;
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            fail(why, "cannot open " + path + ": " + strerror(errno));
+            return nullopt;
+        }
+        struct stat st;
+        Snapshot s;
+        if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(SnapshotHeader)) {
+            bool cow = mode == SnapshotMode::copy_on_write;
+            void *m = mmap(nullptr,
+                           st.st_size,
+                           cow ? PROT_READ | PROT_WRITE : PROT_READ,
+                           cow ? MAP_PRIVATE : MAP_SHARED,
+                           fd,
+                           0);
+            if (m != MAP_FAILED) {
+                s.base = (char *)m, s.size = st.st_size, s.cow = cow;
+            }
+        }
+        close(fd);
+        if (!s.base) {
+            fail(why, path + " is too short or cannot be mapped");
+            return nullopt;
+        }
+        if (!s.validate(kind, value_size, lazy_size, verify, why)) {
+            return nullopt;
+        }
+        return s;
+    }
+
+    Snapshot(Snapshot &&o) noexcept
+        : base(exchange(o.base, nullptr)), size(o.size), cow(o.cow)
+    {
+    }
+
+    Snapshot &operator=(Snapshot &&o) noexcept
+    {
+        swap(base, o.base);
+        swap(size, o.size);
+        swap(cow, o.cow);
+        return *this;
+    }
+
+    ~Snapshot()
+    {
+        if (base) {
+            munmap(base, size);
+        }
+    }
+
+    const SnapshotHeader &header() const
+    {
+        return *(const SnapshotHeader *)base;
+    }
+
+    // Array i in place. Writable only in copy_on_write mode.
+    template <typename T>
+    T *array(int i) const
+    {
+        return (T *)(base + header().arrays[i].offset);
+    }
+
+    bool writable() const
+    {
+        return cow;
+    }
+
+private:
+    char *base = nullptr;
+    size_t size = 0;
+    bool cow = false;
+
+    Snapshot() = default;
+
+    bool validate(SnapshotKind kind,
+                  uint32_t value_size,
+                  uint32_t lazy_size,
+                  bool verify,
+                  string *why) const
+    {
+        using namespace snapshot_detail;
+        const SnapshotHeader &h = header();
+        if (memcmp(h.magic, magic, sizeof(magic)) != 0) {
+            return fail(why, "not a snapshot file");
+        }
+        if (h.byte_order != byte_order) {
+            return fail(why, "snapshot written with another byte order");
+        }
+        if (h.version != snapshot_version) {
+            return fail(why,
+                        "snapshot version " + to_string(h.version) + ", expected " +
+                            to_string(snapshot_version));
+        }
+        if (h.kind != (uint32_t)kind || h.value_size != value_size ||
+            h.lazy_size != lazy_size) {
+            return fail(why, "snapshot holds another structure or element type");
+        }
+        if (h.file_size != size || size % align != 0 || h.n < 0 || h.n > INT_MAX) {
+            return fail(why, "snapshot truncated or size fields corrupt");
+        }
+        auto expect = layout(kind, h.n, value_size, lazy_size);
+        if (h.array_count != expect.size()) {
+            return fail(why, "snapshot array table corrupt");
+        }
+        uint64_t offset = sizeof(SnapshotHeader);
+        for (size_t i = 0; i < expect.size(); i++) {
+            if (h.arrays[i].offset != offset || h.arrays[i].count != expect[i].first) {
+                return fail(why, "snapshot array table corrupt");
+            }
+            offset += round_up(expect[i].first * expect[i].second);
+        }
+        if (offset != size) {
+            return fail(why, "snapshot array table corrupt");
+        }
+        if (verify) {
+            Checksum sum;
+            sum.add(base + sizeof(SnapshotHeader), size - sizeof(SnapshotHeader));
+            if (sum.value(size) != h.checksum) {
+                return fail(why, "snapshot checksum mismatch");
+            }
+        }
+        return true;
+    }
+};
+
+// O(n) time. Returns false, with the reason in *why, if the file cannot be written.
+template <typename T, auto combine, T identity>
+bool save_snapshot(const string &path,
+                   const SegTree<T, combine, identity> &st,
+                   string *why = nullptr)
+{
+    static_assert(snapshot_detail::Storable<T>);
+    return snapshot_detail::write(path,
+                                  SnapshotKind::seg_tree,
+                                  st.n,
+                                  sizeof(T),
+                                  0,
+                                  {{st.tree.data(), st.tree.size(), sizeof(T)}},
+                                  why);
+}
+
+template <typename Policy>
+bool save_snapshot(const string &path,
+                   const RangeSegTree<Policy> &st,
+                   string *why = nullptr)
+{
+    using T = Policy::T;
+    using L = Policy::L;
+    static_assert(snapshot_detail::Storable<T> && snapshot_detail::Storable<L>);
+    return snapshot_detail::write(path,
+                                  SnapshotKind::range_seg_tree,
+                                  st.n,
+                                  sizeof(T),
+                                  sizeof(L),
+                                  {{st.tree.data(), st.tree.size(), sizeof(T)},
+                                   {st.lazy.data(), st.lazy.size(), sizeof(L)}},
+                                  why);
+}
+
+template <typename T>
+bool save_snapshot(const string &path, const Fenwick<T> &fw, string *why = nullptr)
+{
+    static_assert(snapshot_detail::Storable<T>);
+    return snapshot_detail::write(path,
+                                  SnapshotKind::fenwick,
+                                  fw.n,
+                                  sizeof(T),
+                                  0,
+                                  {{fw.tree.data(), fw.tree.size(), sizeof(T)}},
+                                  why);
+}
+
+inline bool save_snapshot(const string &path, const DSU &dsu, string *why = nullptr)
+{
+    uint64_t n = dsu.n;
+    return snapshot_detail::write(path,
+                                  SnapshotKind::dsu,
+                                  dsu.n,
+                                  sizeof(int),
+                                  0,
+                                  {{dsu.parents.data(), n, sizeof(int)},
+                                   {dsu.sizes.data(), n, sizeof(int)}},
+                                  why);
+}
+
+// A SegTree read from a snapshot: same layout and traversal, so the same answers.
+template <typename T, auto combine, T identity = T{}>
+struct SegTreeView
+{
+    int n;
+
+    // O(1) time, plus O(n) with verify. nullopt, with the reason in *why, on failure.
+    static optional<SegTreeView> open(const string &path,
+                                      SnapshotMode mode = SnapshotMode::read_only,
+                                      bool verify = true,
+                                      string *why = nullptr)
+    {
+        auto s = Snapshot::open(path,
+                                SnapshotKind::seg_tree,
+                                sizeof(T),
+                                0,
+                                mode,
+                                verify,
+                                why);
+        if (!s) {
+            return nullopt;
+        }
+        return SegTreeView(std::move(*s));
+    }
+
+    // O(log n) time - returns combine over [l, r].
+    T query(int l, int r) const
+    {
+        assert(l >= 0 && r < n && l <= r);
+        return query(1, 0, n - 1, l, r);
+    }
+
+    // O(log n) time - sets element idx to val. copy_on_write mode only.
+    void update(int idx, T val)
+    {
+        assert(snap.writable() && idx >= 0 && idx < n);
+        update(1, 0, n - 1, idx, val);
+    }
+
+private:
+    Snapshot snap;
+    T *tree;
+
+    explicit SegTreeView(Snapshot &&s)
+        : n(s.header().n), snap(std::move(s)), tree(snap.array<T>(0))
+    {
+    }
+
+    T query(int v, int tl, int tr, int l, int r) const
+    {
+        if (r < tl || tr < l) {
+            return identity;
+        }
+        if (l <= tl && tr <= r) {
+            return tree[v];
+        }
+        int mid = tl + (tr - tl) / 2;
+        return combine(query(2 * v, tl, mid, l, r),
+                       query(2 * v + 1, mid + 1, tr, l, r));
+    }
+
+    void update(int v, int tl, int tr, int idx, T val)
+    {
+        if (tl == tr) {
+            tree[v] = val;
+            return;
+        }
+        int mid = tl + (tr - tl) / 2;
+        if (idx <= mid) {
+            update(2 * v, tl, mid, idx, val);
+        }
+        else {
+            update(2 * v + 1, mid + 1, tr, idx, val);
+        }
+        tree[v] = combine(tree[2 * v], tree[2 * v + 1]);
+    }
+};
+
+// A RangeSegTree read from a snapshot, query-only. Pending lazies are not pushed down:
+// the query carries the composition of the lazies above each node and applies it to
+// the node's value, so the mapped arrays are never written.
+template <typename Policy>
+struct RangeSegTreeView
+{
+    using T = Policy::T;
+    using L = Policy::L;
+
+    int n;
+
+    // O(1) time, plus O(n) with verify. nullopt, with the reason in *why, on failure.
+    static optional<RangeSegTreeView> open(const string &path,
+                                           SnapshotMode mode = SnapshotMode::read_only,
+                                           bool verify = true,
+                                           string *why = nullptr)
+    {
+        auto s = Snapshot::open(path,
+                                SnapshotKind::range_seg_tree,
+                                sizeof(T),
+                                sizeof(L),
+                                mode,
+                                verify,
+                                why);
+        if (!s) {
+            return nullopt;
+        }
+        return RangeSegTreeView(std::move(*s));
+    }
+
+    // O(log n) time - returns combined value of [l, r].
+    T query(int l, int r) const
+    {
+        assert(l >= 0 && r < n && l <= r);
+        return query(1, 0, n - 1, l, r, Policy::lazy_init);
+    }
+
+private:
+    Snapshot snap;
+    const T *tree;
+    const L *lazy;
+
+    explicit RangeSegTreeView(Snapshot &&s)
+        : n(s.header().n),
+          snap(std::move(s)),
+          tree(snap.array<T>(0)),
+          lazy(snap.array<L>(1))
+    {
+    }
+
+    // pending: the lazies of the proper ancestors of v, merged oldest first.
+    T query(int v, int tl, int tr, int l, int r, const L &pending) const
+    {
+        if (r < tl || tr < l) {
+            return Policy::query_oob;
+        }
+        if (l <= tl && tr <= r) {
+            return Policy::apply(tree[v], pending, tr - tl + 1);
+        }
+        L down = Policy::merge(lazy[v], pending);
+        int mid = tl + (tr - tl) / 2;
+        return Policy::combine(query(2 * v, tl, mid, l, r, down),
+                               query(2 * v + 1, mid + 1, tr, l, r, down));
+    }
+};
+
+// A Fenwick tree read from a snapshot.
+template <typename T>
+struct FenwickView
+{
+    int n;
+
+    // O(1) time, plus O(n) with verify. nullopt, with the reason in *why, on failure.
+    static optional<FenwickView> open(const string &path,
+                                      SnapshotMode mode = SnapshotMode::read_only,
+                                      bool verify = true,
+                                      string *why = nullptr)
+    {
+        auto s = Snapshot::open(path,
+                                SnapshotKind::fenwick,
+                                sizeof(T),
+                                0,
+                                mode,
+                                verify,
+                                why);
+        if (!s) {
+            return nullopt;
+        }
+        return FenwickView(std::move(*s));
+    }
+
+    // Returns the prefix sum [0, r]. O(log n) time.
+    T query(int r) const
+    {
+        T result{};
+        for (; r >= 0; r = (r & (r + 1)) - 1) {
+            result += tree[r];
+        }
+        return result;
+    }
+
+    // Returns the range sum [l, r]. O(log n) time.
+    T query(int l, int r) const
+    {
+        return query(r) - query(l - 1);
+    }
+
+    // Adds delta to index idx. O(log n) time. copy_on_write mode only.
+    void add(int idx, T delta)
+    {
+        assert(snap.writable());
+        for (; idx < n; idx = idx | (idx + 1)) {
+            tree[idx] += delta;
+        }
+    }
+
+private:
+    Snapshot snap;
+    T *tree;
+
+    explicit FenwickView(Snapshot &&s)
+        : n(s.header().n), snap(std::move(s)), tree(snap.array<T>(0))
+    {
+    }
+};
+
+// A DSU read from a snapshot. Read-only, find walks to the root without compressing
+// (O(log n): the saved forest is union by size); copy_on_write mode compresses paths
+// and allows merge.
+struct DSUView
+{
+    int n;
+
+    // O(1) time, plus O(n) with verify. nullopt, with the reason in *why, on failure.
+    static optional<DSUView> open(const string &path,
+                                  SnapshotMode mode = SnapshotMode::read_only,
+                                  bool verify = true,
+                                  string *why = nullptr)
+    {
+        auto s = Snapshot::open(path,
+                                SnapshotKind::dsu,
+                                sizeof(int),
+                                0,
+                                mode,
+                                verify,
+                                why);
+        if (!s) {
+            return nullopt;
+        }
+        return DSUView(std::move(*s));
+    }
+
+    // Returns the root of u's set. O(log n), O(a(n)) amortized in copy_on_write mode.
+    int find(int u)
+    {
+        assert(u >= 0 && u < n);
+        int root = u;
+        while (parents[root] != root) {
+            root = parents[root];
+        }
+        if (snap.writable()) {
+            while (parents[u] != root) {
+                u = exchange(parents[u], root);
+            }
+        }
+        return root;
+    }
+
+    bool same(int u, int v)
+    {
+        return find(u) == find(v);
+    }
+
+    // Returns the number of elements in u's set.
+    int size(int u)
+    {
+        return sizes[find(u)];
+    }
+
+    // Merges the sets containing u and v. copy_on_write mode only.
+    void merge(int u, int v)
+    {
+        assert(snap.writable());
+        u = find(u);
+        v = find(v);
+        if (u == v) {
+            return;
+        }
+        if (sizes[u] < sizes[v]) {
+            swap(u, v);
+        }
+        parents[v] = u;
+        sizes[u] += sizes[v];
+    }
+
+private:
+    Snapshot snap;
+    int *parents;
+    int *sizes;
+
+    explicit DSUView(Snapshot &&s)
+        : n(s.header().n),
+          snap(std::move(s)),
+          parents(snap.array<int>(0)),
+          sizes(snap.array<int>(1))
+    {
+    }
+};
+} // namespace cp
@@ -0,0 +1,211 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Sparse table - O(1) range queries on a static array for an idempotent combine
+// (min, max, gcd, bitwise and / or): combine(x, x) == x, so two overlapping
+// power-of-two windows cover [l, r] exactly once in effect.
+//
+// combine is a non-type template parameter, as in SegTree: a captureless lambda,
+// function pointer or empty struct such as bit_and<int>{}. It must be associative and
+// idempotent. Levels are stored level-major in one flat array, so the two reads of a
+// query come from the same level.
+//
+// Usage:
+//   constexpr auto mn = [](ll a, ll b) { return min(a, b); };
+//   SparseTable<ll, mn> st(a);
+//   st.query(l, r);                        // min of a[l..r]
+//   SparseTable<ll, [](ll a, ll b) { return gcd(a, b); }> g(a);
+//
+// Reference: https://cp-algorithms.com/data_structures/sparse-table.html
+template <typename T, auto combine>
+struct SparseTable
+{
+    int n;
+    int levels;
+    vector<T> table; // table[k * n + i] = combine over [i, i + 2^k)
+
+    // O(n log n) time, O(n log n) space.
+    SparseTable(const vector<T> &a)
+        : n(a.size()), levels(bit_width((unsigned)n)), table((size_t)levels * n)
+    {
+        copy(a.begin(), a.end(), table.begin());
+        for (int k = 1; k < levels; k++) {
+            const T *prev = &table[(size_t)(k - 1) * n];
+            T *cur = &table[(size_t)k * n];
+            for (int i = 0; i + (1 << k) <= n; i++) {
+                cur[i] = combine(prev[i], prev[i + (1 << (k - 1))]);
+            }
+        }
+    }
+
+    // O(1) time - returns combine over [l, r].
+    T query(int l, int r) const
+    {
+        assert(l >= 0 && r < n && l <= r);
+        int k = bit_width((unsigned)(r - l + 1)) - 1;
+        const T *row = &table[(size_t)k * n];
+        return combine(row[l], row[r - (1 << k) + 1]);
+    }
+};
+
+// Disjoint sparse table - O(1) range queries on a static array for any associative
+// combine (sum, product, matrix product, mod arithmetic, ...), no idempotence needed.
+//
+// Level h cuts the array into blocks of 2^(h+1) positions and stores, for each block
+// with middle m, combine over [i, m) for i left of m and over [m, i] for i from m on.
+// For l < r the highest set bit h of l ^ r puts l and r in one level-h block, on
+// opposite sides of its middle, so the answer is combine(table[h][l], table[h][r]).
+// Level 0 is the array itself and answers l == r.
+//
+// Usage:
+//   DisjointSparseTable<ll, plus<ll>{}> dst(a);
+//   dst.query(l, r);                       // a[l] + ... + a[r]
+//
+// Reference: https://discuss.codechef.com/t/tutorial-disjoint-sparse-table/17404
+template <typename T, auto combine>
+struct DisjointSparseTable
+{
+    int n;
+    int levels;
+    vector<T> table; // table[h * n + i], see above
+
+    // O(n log n) time, O(n log n) space.
+    DisjointSparseTable(const vector<T> &a)
+        : n(a.size()),
+          levels(n <= 1 ? 1 : bit_width((unsigned)(n - 1))),
+          table((size_t)levels * n)
+    {
+        copy(a.begin(), a.end(), table.begin());
+        for (int h = 1; h < levels; h++) {
+            T *row = &table[(size_t)h * n];
+            int half = 1 << h;
+            for (int m = half; m < n; m += 2 * half) {
+                row[m - 1] = a[m - 1];
+                for (int i = m - 2; i >= m - half; i--) {
+                    row[i] = combine(a[i], row[i + 1]);
+                }
+                row[m] = a[m];
+                for (int i = m + 1; i < min(n, m + half); i++) {
+                    row[i] = combine(row[i - 1], a[i]);
+                }
+            }
+        }
+    }
+
+    // O(1) time - returns combine over [l, r].
+    T query(int l, int r) const
+    {
+        assert(l >= 0 && r < n && l <= r);
+        if (l == r) {
+            return table[l];
+        }
+        int h = bit_width((unsigned)(l ^ r)) - 1;
+        const T *row = &table[(size_t)h * n];
+        return combine(row[l], row[r]);
+    }
+};
+
+// Block sparse table - O(n) build and O(1) range minimum (or maximum) and argmin.
+// Beside the values it keeps an 8-byte mask per element and a table over n / 64
+// blocks, about 10 bytes per element where SparseTable<int> needs 4 log n (120 at
+// n = 1e9).
+//
+// Positions are split into 64-wide blocks:
+//   - inside a block, mask[i] has bit j set when position (block start + j) is on the
+//     monotonic stack of minima ending at i; the minimum of [l, i] is then the lowest
+//     set bit of mask[i] at or above l, found with one countr_zero.
+//   - across blocks, a sparse table of block argmin positions over the n / 64 blocks.
+// A query is two in-block lookups plus two sparse table reads and never loops.
+//
+// compare is a strict weak order as a non-type template parameter: less<T>{} (the
+// default) for minimum, greater<T>{} for maximum. Ties resolve to the leftmost
+// position. The values are taken by value, so moving a large array in avoids a copy.
+//
+// Usage:
+//   BlockSparseTable<int> rmq(std::move(a));
+//   rmq.query(l, r);                       // min of a[l..r]
+//   rmq.argmin(l, r);                      // its leftmost position
+//   BlockSparseTable<ll, greater<ll>{}> rmax(b);
+//
+// Reference: https://cp-algorithms.com/graph/lca_farachcoltonbender.html
+template <typename T, auto compare = less<T>{}>
+struct BlockSparseTable
+{
+    static constexpr int B = 64; // block width, one bit per position in a u64 mask
+
+    int n;
+    int blocks;
+    vector<T> a;
+    vector<ull> mask;   // in-block monotonic stack of minima ending at each position
+    vector<int> sparse; // sparse[k * blocks + b] = argmin over blocks [b, b + 2^k)
+
+    // O(n) time, O(n) space.
+    BlockSparseTable(vector<T> values)
+        : n(values.size()), blocks((n + B - 1) / B), a(std::move(values)), mask(n)
+    {
+        for (int b = 0; b < blocks; b++) {
+            int start = b * B, end = min(n, start + B);
+            ull cur = 0;
+            for (int i = start; i < end; i++) {
+                // Pop strictly worse values; ties keep the earlier position.
+                while (cur && compare(a[i], a[start + 63 - countl_zero(cur)])) {
+                    cur &= ~(1ULL << (63 - countl_zero(cur)));
+                }
+                cur |= 1ULL << (i - start);
+                mask[i] = cur;
+            }
+        }
+        int levels = bit_width((unsigned)blocks);
+        sparse.resize((size_t)levels * blocks);
+        for (int b = 0; b < blocks; b++) {
+            sparse[b] = block_argmin(b * B, min(n, b * B + B) - 1);
+        }
+        for (int k = 1; k < levels; k++) {
+            const int *prev = &sparse[(size_t)(k - 1) * blocks];
+            int *cur = &sparse[(size_t)k * blocks];
+            for (int b = 0; b + (1 << k) <= blocks; b++) {
+                cur[b] = better(prev[b], prev[b + (1 << (k - 1))]);
+            }
+        }
+    }
+
+    // O(1) time - leftmost position of the minimum (under compare) of [l, r].
+    int argmin(int l, int r) const
+    {
+        assert(l >= 0 && r < n && l <= r);
+        int bl = l / B, br = r / B;
+        if (bl == br) {
+            return block_argmin(l, r);
+        }
+        int res = block_argmin(l, bl * B + B - 1);
+        if (bl + 1 < br) {
+            int k = bit_width((unsigned)(br - bl - 1)) - 1;
+            const int *row = &sparse[(size_t)k * blocks];
+            res = better(res, better(row[bl + 1], row[br - (1 << k)]));
+        }
+        return better(res, block_argmin(br * B, r));
+    }
+
+    // O(1) time - minimum (under compare) of [l, r].
+    T query(int l, int r) const
+    {
+        return a[argmin(l, r)];
+    }
+
+private:
+    // i if a[i] is no worse than a[j], else j; i is the left one on ties.
+    int better(int i, int j) const
+    {
+        return compare(a[j], a[i]) ? j : i;
+    }
+
+    // Argmin of a[l..r] within one block, via the stack mask at r.
+    int block_argmin(int l, int r) const
+    {
+        ull m = mask[r] & (~0ULL << (l % B));
+        return r / B * B + countr_zero(m);
+    }
+};
+} // namespace cp
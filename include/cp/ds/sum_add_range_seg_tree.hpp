@@ -1,5 +1,6 @@
 #pragma once
 #include "cp/core/common.hpp"
+#include "cp/core/stats.hpp"
 
 namespace cp
 {
@@ -23,6 +24,7 @@ struct SumAddRangeSegTree
     int n;
     vector<T> tree;
     vector<T> lazy;
+    [[no_unique_address]] StatsCounter stat; // node_visits, pushdowns, lazy_pushdowns
 
     // O(n) time, O(n) space.
     SumAddRangeSegTree(int size) : n(size), tree(4 * size, T{}), lazy(4 * size, T{}) {}
@@ -50,6 +52,17 @@ struct SumAddRangeSegTree
         return query(1, 0, n - 1, l, r);
     }
 
+    // Hot-path counters (cp/core/stats.hpp); all zero unless built with CP_STATS.
+    Stats stats() const
+    {
+        return stat.get();
+    }
+
+    void reset_stats()
+    {
+        stat.reset();
+    }
+
 private:
     void build(int v, int tl, int tr, const vector<T> &a)
     {
@@ -66,9 +79,11 @@ private:
     // Pushes lazy[v] down to children and clears it.
     void push_down(int v, int tl, int tr)
     {
+        CP_STAT(stat.s.pushdowns++);
         if (lazy[v] == T{}) {
             return;
         }
+        CP_STAT(stat.s.lazy_pushdowns++);
         int mid = tl + (tr - tl) / 2; // avoids overflow vs (tl + tr) / 2
         tree[2 * v] += lazy[v] * (mid - tl + 1);
         lazy[2 * v] += lazy[v];
@@ -79,6 +94,7 @@ private:
 
     void update(int v, int tl, int tr, int l, int r, T val)
     {
+        CP_STAT(stat.s.node_visits++);
         if (r < tl || tr < l) {
             return;
         }
@@ -96,6 +112,7 @@ private:
 
     T query(int v, int tl, int tr, int l, int r)
     {
+        CP_STAT(stat.s.node_visits++);
         if (r < tl || tr < l) {
             return T{};
         }
@@ -0,0 +1,110 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include "cp/geometry/point.hpp"
+
+namespace cp
+{
+// Closest pair of points by divide and conquer, with exact i128 distances.
+//
+// Points are sorted by x once into local SoA arrays (xs, ys, original index). Each
+// recursive call sorts its half by y as it returns, by merging into one scratch buffer
+// allocated for the whole run, so the combine step scans the strip around the split
+// line in y order and compares each point with the strip points less than sqrt(best)
+// below it (at most 7). Recursion depth is O(log n).
+//
+// dist2 is the squared distance and i, j (i < j) are indices into the input.
+//
+// Usage:
+//   ClosestPair cp(pts);   // pts.size() >= 2
+//   cp.dist2, cp.i, cp.j;
+//
+// Reference: https://cp-algorithms.com/geometry/nearest_points.html
+struct ClosestPair
+{
+    i128 dist2 = -1;
+    int i = -1, j = -1;
+
+    // O(n log n) time, O(n) space.
+    ClosestPair(const Points &pts)
+    {
+        int n = pts.size();
+        assert(n >= 2);
+        vector<int> order(n);
+        iota(order.begin(), order.end(), 0);
+        sort(order.begin(), order.end(), [&](int a, int b) { return pts[a] < pts[b]; });
+        xs.resize(n), ys.resize(n), id.resize(n);
+        for (int k = 0; k < n; k++) {
+            xs[k] = pts.xs[order[k]];
+            ys[k] = pts.ys[order[k]];
+            id[k] = order[k];
+        }
+        bx.resize(n), by.resize(n), bid.resize(n);
+        solve(0, n);
+        if (i > j) {
+            swap(i, j);
+        }
+    }
+
+private:
+    vector<ll> xs, ys, bx, by;
+    vector<int> id, bid;
+
+    void consider(int a, int b)
+    {
+        i128 dx = (i128)xs[a] - xs[b], dy = (i128)ys[a] - ys[b];
+        i128 d = dx * dx + dy * dy;
+        if (dist2 < 0 || d < dist2) {
+            dist2 = d, i = id[a], j = id[b];
+        }
+    }
+
+    // On return [l, r) is sorted by y.
+    void solve(int l, int r)
+    {
+        if (r - l <= 3) {
+            for (int a = l; a < r; a++) {
+                for (int b = a + 1; b < r; b++) {
+                    consider(a, b);
+                }
+            }
+            for (int a = l + 1; a < r; a++) { // insertion sort by y
+                for (int b = a; b > l && ys[b - 1] > ys[b]; b--) {
+                    swap(xs[b - 1], xs[b]);
+                    swap(ys[b - 1], ys[b]);
+                    swap(id[b - 1], id[b]);
+                }
+            }
+            return;
+        }
+        int m = (l + r) / 2;
+        ll mid_x = xs[m];
+        solve(l, m);
+        solve(m, r);
+        // merge the halves by y through the scratch buffer
+        int a = l, b = m, k = l;
+        while (a < m || b < r) {
+            int s = b == r || (a < m && ys[a] <= ys[b]) ? a++ : b++;
+            bx[k] = xs[s], by[k] = ys[s], bid[k] = id[s], k++;
+        }
+        copy(bx.begin() + l, bx.begin() + r, xs.begin() + l);
+        copy(by.begin() + l, by.begin() + r, ys.begin() + l);
+        copy(bid.begin() + l, bid.begin() + r, id.begin() + l);
+        // strip around the split line, reusing the scratch buffer for its positions
+        int len = 0;
+        for (int t = l; t < r; t++) {
+            i128 dx = (i128)xs[t] - mid_x;
+            if (dx * dx >= dist2) {
+                continue;
+            }
+            for (int s = len - 1; s >= 0; s--) {
+                i128 dy = (i128)ys[t] - ys[bid[s]];
+                if (dy * dy >= dist2) {
+                    break;
+                }
+                consider(bid[s], t);
+            }
+            bid[len++] = t;
+        }
+    }
+};
+} // namespace cp
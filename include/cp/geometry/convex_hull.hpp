@@ -0,0 +1,157 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include "cp/geometry/point.hpp"
+
+namespace cp
+{
+// Convex hull by Andrew's monotone chain, with exact integer predicates.
+//
+// Before sorting, an Akl-Toussaint pass drops every point strictly inside the
+// quadrilateral of the leftmost, lowest, rightmost and highest points. On large
+// random inputs that removes almost everything, so the O(n log n) sort runs on a small
+// remainder and the O(n) filter - a fused loop over the xs / ys streams, in ll when
+// coordinates are below 2^30 - dominates.
+//
+// The hull is returned counter-clockwise, starting from the lexicographically
+// smallest point, without collinear points or duplicates. One distinct point gives a
+// hull of size 1, collinear inputs a hull of size 2.
+//
+// Usage:
+//   Points hull = convex_hull(pts);
+//   i128 d2 = hull_diameter2(hull);   // squared diameter, exact
+//   long double w = hull_width(hull); // minimum width
+//
+// Reference: https://cp-algorithms.com/geometry/convex-hull.html
+inline Points convex_hull(const Points &pts)
+{
+    int n = pts.size();
+    if (n == 0) {
+        return {};
+    }
+    const ll *xs = pts.xs.data(), *ys = pts.ys.data();
+    // Extreme points, in counter-clockwise order: left, bottom, right, top.
+    array<int, 4> ext = {0, 0, 0, 0};
+    ll bound = 0;
+    for (int i = 0; i < n; i++) {
+        ext[0] = xs[i] < xs[ext[0]] ? i : ext[0];
+        ext[1] = ys[i] < ys[ext[1]] ? i : ext[1];
+        ext[2] = xs[i] > xs[ext[2]] ? i : ext[2];
+        ext[3] = ys[i] > ys[ext[3]] ? i : ext[3];
+        bound = max(bound, max(abs(xs[i]), abs(ys[i])));
+    }
+    // Edges of the quadrilateral; coincident extremes leave fewer than 4 distinct
+    // edges, and the gaps are padded with copies so the inner loop stays fixed-size.
+    vector<pair<Point, Point>> edges;
+    for (int k = 0; k < 4; k++) {
+        Point a = pts[ext[k]], b = pts[ext[(k + 1) % 4]];
+        if (!(a == b)) {
+            edges.push_back({a, b});
+        }
+    }
+    vector<int> idx;
+    auto filter = [&]<typename T>(T) {
+        array<T, 4> ax, ay, dx, dy;
+        for (int k = 0; k < 4; k++) {
+            auto [a, b] = edges[k % edges.size()];
+            ax[k] = a.x, ay[k] = a.y, dx[k] = b.x - a.x, dy[k] = b.y - a.y;
+        }
+        for (int i = 0; i < n; i++) {
+            bool inside = true;
+            for (int k = 0; k < 4; k++) {
+                inside &= dx[k] * (ys[i] - ay[k]) - dy[k] * (xs[i] - ax[k]) > 0;
+            }
+            if (!inside) {
+                idx.push_back(i);
+            }
+        }
+    };
+    if (edges.empty()) {
+        idx.push_back(0); // every point equals pts[0]
+    }
+    else if (bound < (1LL << 30)) {
+        filter(ll{});
+    }
+    else {
+        filter(i128{});
+    }
+    sort(idx.begin(), idx.end(), [&](int a, int b) {
+        return xs[a] != xs[b] ? xs[a] < xs[b] : ys[a] < ys[b];
+    });
+    idx.erase(unique(idx.begin(),
+                     idx.end(),
+                     [&](int a, int b) { return xs[a] == xs[b] && ys[a] == ys[b]; }),
+              idx.end());
+    int m = idx.size();
+    if (m <= 1) {
+        Points h;
+        h.push_back(pts[idx[0]]);
+        return h;
+    }
+    // Lower hull left to right, then upper hull right to left, popping non-left turns.
+    vector<int> st(2 * m);
+    int k = 0;
+    for (int t = 0; t < m; t++) {
+        while (k >= 2 && cross(pts[st[k - 2]], pts[st[k - 1]], pts[idx[t]]) <= 0) {
+            k--;
+        }
+        st[k++] = idx[t];
+    }
+    for (int t = m - 2, lower = k + 1; t >= 0; t--) {
+        while (k >= lower && cross(pts[st[k - 2]], pts[st[k - 1]], pts[idx[t]]) <= 0) {
+            k--;
+        }
+        st[k++] = idx[t];
+    }
+    k--; // the last point is the first one again
+    Points h;
+    h.reserve(k);
+    for (int i = 0; i < k; i++) {
+        h.push_back(pts[st[i]]);
+    }
+    return h;
+}
+
+// Squared diameter (largest squared distance between two points) of a convex
+// polygon in counter-clockwise order, by rotating calipers. Exact. O(n) time.
+inline i128 hull_diameter2(const Points &h)
+{
+    int n = h.size();
+    if (n <= 1) {
+        return 0;
+    }
+    if (n == 2) {
+        return norm2(h[1] - h[0]);
+    }
+    i128 best = 0;
+    for (int i = 0, j = 1; i < n; i++) {
+        Point a = h[i], b = h[(i + 1) % n];
+        // advance j while it moves farther from edge a-b
+        while (cross(a, b, h[(j + 1) % n]) > cross(a, b, h[j])) {
+            j = (j + 1) % n;
+        }
+        best = max({best, norm2(h[j] - a), norm2(h[j] - b)});
+    }
+    return best;
+}
+
+// Minimum width (smallest distance between two parallel supporting lines) of a convex
+// polygon in counter-clockwise order, by rotating calipers. The antipodal search is
+// exact; only the final division by the edge length is floating point. O(n) time.
+inline long double hull_width(const Points &h)
+{
+    int n = h.size();
+    if (n <= 2) {
+        return 0;
+    }
+    long double best = numeric_limits<long double>::infinity();
+    for (int i = 0, j = 1; i < n; i++) {
+        Point a = h[i], b = h[(i + 1) % n];
+        while (cross(a, b, h[(j + 1) % n]) > cross(a, b, h[j])) {
+            j = (j + 1) % n;
+        }
+        long double len = sqrtl((long double)norm2(b - a));
+        best = min(best, (long double)cross(a, b, h[j]) / len);
+    }
+    return best;
+}
+} // namespace cp
@@ -0,0 +1,153 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Integer 2D points and vectors with exact predicates.
+//
+// Coordinates are ll. cross and dot return i128, which is exact whenever coordinate
+// differences fit in ll (|coordinate| < 2^62); orientation and every hull / caliper
+// decision built on it is therefore exact, with no epsilon.
+//
+// Usage:
+//   Point a{1, 2}, b{3, 4};
+//   cross(a, b);              // i128
+//   orientation(o, a, b);     // +1 counter-clockwise, -1 clockwise, 0 collinear
+struct Point
+{
+    ll x = 0, y = 0;
+
+    Point operator+(const Point &o) const
+    {
+        return {x + o.x, y + o.y};
+    }
+
+    Point operator-(const Point &o) const
+    {
+        return {x - o.x, y - o.y};
+    }
+
+    Point operator*(ll k) const
+    {
+        return {x * k, y * k};
+    }
+
+    // Rotation by 90 degrees counter-clockwise.
+    Point perp() const
+    {
+        return {-y, x};
+    }
+
+    bool operator==(const Point &o) const = default;
+
+    // Lexicographic by (x, y), the order of Andrew's monotone chain.
+    bool operator<(const Point &o) const
+    {
+        return x != o.x ? x < o.x : y < o.y;
+    }
+};
+
+inline i128 cross(const Point &a, const Point &b)
+{
+    return (i128)a.x * b.y - (i128)a.y * b.x;
+}
+
+inline i128 dot(const Point &a, const Point &b)
+{
+    return (i128)a.x * b.x + (i128)a.y * b.y;
+}
+
+// cross(a - o, b - o): twice the signed area of triangle o, a, b.
+inline i128 cross(const Point &o, const Point &a, const Point &b)
+{
+    return cross(a - o, b - o);
+}
+
+// Squared length, exact.
+inline i128 norm2(const Point &a)
+{
+    return dot(a, a);
+}
+
+// +1 if o -> a -> b turns counter-clockwise, -1 if clockwise, 0 if collinear.
+inline int orientation(const Point &o, const Point &a, const Point &b)
+{
+    i128 c = cross(o, a, b);
+    return (c > 0) - (c < 0);
+}
+
+// Point array stored structure-of-arrays: all x coordinates, then all y coordinates.
+//
+// Kernels that touch every point (orientation against a fixed line, bounding boxes,
+// hull filters) read two dense ll streams, which the compiler vectorizes; an array of
+// pair<ll, ll> interleaves the fields and mostly defeats that.
+struct Points
+{
+    vector<ll> xs, ys;
+
+    Points() = default;
+
+    // O(n) time, O(n) space - n points at the origin.
+    Points(size_t n) : xs(n), ys(n) {}
+
+    // O(n) time, O(n) space - converts an array of points.
+    Points(const vector<Point> &a) : xs(a.size()), ys(a.size())
+    {
+        for (size_t i = 0; i < a.size(); i++) {
+            xs[i] = a[i].x;
+            ys[i] = a[i].y;
+        }
+    }
+
+    size_t size() const
+    {
+        return xs.size();
+    }
+
+    void reserve(size_t n)
+    {
+        xs.reserve(n);
+        ys.reserve(n);
+    }
+
+    void push_back(const Point &p)
+    {
+        xs.push_back(p.x);
+        ys.push_back(p.y);
+    }
+
+    Point operator[](size_t i) const
+    {
+        return {xs[i], ys[i]};
+    }
+};
+
+// out[i] = orientation(a, b, pts[i]) for every point. O(n) time.
+//
+// If every coordinate involved is below 2^30 in absolute value, the cross products fit
+// in ll and the main loop is plain ll arithmetic that vectorizes; otherwise it falls
+// back to exact i128. The bound is checked with a vectorized max-abs pass first.
+inline void orientations(const Points &pts, Point a, Point b, span<int8_t> out)
+{
+    assert(out.size() >= pts.size());
+    size_t n = pts.size();
+    const ll *xs = pts.xs.data(), *ys = pts.ys.data();
+    constexpr ll small = 1LL << 30;
+    ll bound = max({abs(a.x), abs(a.y), abs(b.x), abs(b.y)});
+    for (size_t i = 0; i < n; i++) {
+        bound = max(bound, max(abs(xs[i]), abs(ys[i])));
+    }
+    ll dx = b.x - a.x, dy = b.y - a.y;
+    if (bound < small) {
+        for (size_t i = 0; i < n; i++) {
+            ll c = dx * (ys[i] - a.y) - dy * (xs[i] - a.x);
+            out[i] = (c > 0) - (c < 0);
+        }
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        i128 c = (i128)dx * (ys[i] - a.y) - (i128)dy * (xs[i] - a.x);
+        out[i] = (c > 0) - (c < 0);
+    }
+}
+} // namespace cp
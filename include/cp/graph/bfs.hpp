@@ -0,0 +1,172 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include "cp/core/parallel.hpp"
+#include "cp/graph/csr_graph.hpp"
+
+namespace cp
+{
+// Direction-optimizing parallel BFS (Beamer, Asanovic, Patterson).
+//
+// Every level is expanded one of two ways:
+//   - top-down: each frontier vertex scans its out-edges and claims unvisited
+//     neighbors. Cost ~ edges leaving the frontier.
+//   - bottom-up: each unvisited vertex scans its in-edges and stops at the first one
+//     coming from the frontier. Cost ~ edges into unvisited vertices, but most scans
+//     stop early once the frontier is a large part of the graph.
+// The search goes bottom-up when the frontier's out-edges exceed 1/ALPHA of the edges
+// still unexplored, and back top-down when the frontier drops below n/BETA vertices
+// and is shrinking. On low-diameter graphs the few middle levels, which hold most of
+// the edges, are then done bottom-up and skip most edge checks.
+//
+// Visited vertices and the bottom-up frontier are bitmaps (one bit per vertex). Top-
+// down threads claim a vertex with an atomic fetch_or on its visited word, so each
+// vertex gets exactly one parent; bottom-up threads own whole 64-vertex words and need
+// no atomics. Each level is one parallel_for, and levels with little work run inline.
+//
+// dist[v] (and parent[v], when given) are written for every v: -1 when v is not
+// reachable, parent[source] = -1. For a directed graph pass in = &reversed graph so
+// bottom-up steps can scan in-edges; for an undirected graph g serves both ways. I is
+// deduced from g alone (type_identity_t), so vectors convert to the spans.
+//
+// Usage:
+//   vector<int> dist(g.n), parent(g.n);
+//   bfs(g, s, dist, parent);            // undirected g, all hardware threads
+//   CSRGraph<> r = g.reversed();
+//   bfs(g, s, dist, parent, 8, &r);     // directed g, 8 threads
+//
+// O(V + E) work. Returns the number of vertices reached (including the source).
+//
+// Reference: Beamer, Asanovic, Patterson - "Direction-optimizing breadth-first search"
+// (SC 2012)
+template <typename I, typename W>
+I bfs(const CSRGraph<I, W> &g,
+      type_identity_t<I> source,
+      span<type_identity_t<I>> dist,
+      span<type_identity_t<I>> parent = {},
+      int threads = 0,
+      const CSRGraph<I, W> *in = nullptr)
+{
+    constexpr ll ALPHA = 14, BETA = 24; // switching thresholds from the paper
+    constexpr ll GRAIN = 1 << 14;       // minimum work per thread
+    I n = g.n;
+    assert(source >= 0 && source < n);
+    assert((I)dist.size() >= n && (parent.empty() || (I)parent.size() >= n));
+    assert(in == nullptr || in->n == n);
+    if (in == nullptr) {
+        in = &g;
+    }
+    if (threads <= 0) {
+        threads = hardware_threads();
+    }
+    auto workers = [&](ll work) { return (int)clamp<ll>(work / GRAIN, 1, threads); };
+    bool with_parent = !parent.empty();
+    parallel_for(workers(n), n, [&](ll begin, ll end, int) {
+        fill(dist.begin() + begin, dist.begin() + end, -1);
+        if (with_parent) {
+            fill(parent.begin() + begin, parent.begin() + end, -1);
+        }
+    });
+
+    size_t words = ((size_t)n + 63) / 64;
+    vector<ull> visited(words, 0), front(words, 0), next(words, 0);
+    visited[source / 64] |= 1ULL << (source % 64);
+    dist[source] = 0;
+    vector<I> queue = {source};
+    vector<vector<I>> local(threads);
+    vector<ll> local_edges(threads);
+    vector<I> local_count(threads);
+
+    ll unexplored = (ll)g.num_edges() - g.degree(source);
+    ll frontier_edges = g.degree(source);
+    I frontier = 1, prev_frontier = 0, reached = 1;
+    bool bottom_up = false;
+    for (I level = 1; frontier > 0; level++) {
+        if (!bottom_up && frontier_edges > unexplored / ALPHA) {
+            bottom_up = true; // queue -> bitmap
+            fill(front.begin(), front.end(), 0);
+            for (I v : queue) {
+                front[v / 64] |= 1ULL << (v % 64);
+            }
+        }
+        else if (bottom_up && frontier < n / BETA && frontier < prev_frontier) {
+            bottom_up = false; // bitmap -> queue
+            queue.clear();
+            for (size_t w = 0; w < words; w++) {
+                for (ull bits = front[w]; bits; bits &= bits - 1) {
+                    queue.push_back(w * 64 + countr_zero(bits));
+                }
+            }
+        }
+        fill(local_edges.begin(), local_edges.end(), 0);
+        fill(local_count.begin(), local_count.end(), 0);
+        if (!bottom_up) {
+            for (auto &q : local) {
+                q.clear();
+            }
+            parallel_for(workers(frontier_edges), queue.size(), [&](ll b, ll e, int t) {
+                for (ll i = b; i < e; i++) {
+                    I v = queue[i];
+                    for (I to : g.neighbors(v)) {
+                        ull bit = 1ULL << (to % 64);
+                        atomic_ref<ull> word(visited[to / 64]);
+                        if ((word.load(memory_order_relaxed) & bit) ||
+                            (word.fetch_or(bit, memory_order_relaxed) & bit)) {
+                            continue; // already visited, or another thread won
+                        }
+                        dist[to] = level;
+                        if (with_parent) {
+                            parent[to] = v;
+                        }
+                        local[t].push_back(to);
+                        local_edges[t] += g.degree(to);
+                    }
+                }
+            });
+            queue.clear();
+            for (auto &q : local) {
+                queue.insert(queue.end(), q.begin(), q.end());
+            }
+            local_count[0] = queue.size();
+        }
+        else {
+            parallel_for(workers(unexplored), words, [&](ll b, ll e, int t) {
+                for (ll w = b; w < e; w++) {
+                    ull found = 0;
+                    ull todo = ~visited[w];
+                    if (w == (ll)words - 1 && n % 64) {
+                        todo &= (1ULL << (n % 64)) - 1; // past the last vertex
+                    }
+                    for (; todo; todo &= todo - 1) {
+                        I v = w * 64 + countr_zero(todo);
+                        for (I u : in->neighbors(v)) {
+                            if (front[u / 64] >> (u % 64) & 1) {
+                                dist[v] = level;
+                                if (with_parent) {
+                                    parent[v] = u;
+                                }
+                                found |= todo & -todo;
+                                local_count[t]++;
+                                local_edges[t] += g.degree(v);
+                                break;
+                            }
+                        }
+                    }
+                    next[w] = found;
+                    visited[w] |= found;
+                }
+            });
+            swap(front, next);
+        }
+        prev_frontier = frontier;
+        frontier = 0;
+        frontier_edges = 0;
+        for (int t = 0; t < threads; t++) {
+            frontier += local_count[t];
+            frontier_edges += local_edges[t];
+        }
+        unexplored -= frontier_edges;
+        reached += frontier;
+    }
+    return reached;
+}
+} // namespace cp
@@ -0,0 +1,154 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Hopcroft-Karp maximum bipartite matching.
+//
+// Each phase runs a BFS from all free left vertices that layers the left side by
+// alternating-path distance, then finds a maximal set of vertex-disjoint augmenting
+// paths along those layers. O(sqrt(V)) phases of O(E) each.
+//
+// Adjacency is a CSR (offsets, targets) built from the edge list on the first call to
+// max_matching, and the per-phase DFS is iterative: an explicit stack of left vertices
+// plus a current-arc pointer per vertex, so 1e6-vertex instances with long
+// alternating paths neither recurse nor allocate per phase.
+//
+// Usage:
+//   HopcroftKarp hk(left, right);
+//   hk.add_edge(l, r);            // 0 <= l < left, 0 <= r < right
+//   int m = hk.max_matching();
+//   hk.match_left[l];             // matched right vertex, or -1
+//   hk.match_right[r];            // matched left vertex, or -1
+//
+// Reference: Hopcroft, Karp - "An n^(5/2) algorithm for maximum matchings in bipartite
+// graphs" (1973)
+struct HopcroftKarp
+{
+    int left, right;
+    vector<pair<int, int>> edges;
+    vector<int> offsets, targets; // CSR over left vertices
+    vector<int> match_left, match_right;
+    vector<int> dist, arc, queue, stack;
+
+    // O(left + right) time and space.
+    HopcroftKarp(int left_size, int right_size)
+        : left(left_size),
+          right(right_size),
+          match_left(left_size, -1),
+          match_right(right_size, -1),
+          dist(left_size),
+          arc(left_size)
+    {
+    }
+
+    // Adds the edge l - r. O(1) amortized.
+    void add_edge(int l, int r)
+    {
+        assert(l >= 0 && l < left && r >= 0 && r < right);
+        edges.push_back({l, r});
+    }
+
+    // Grows the current matching to a maximum one and returns its size.
+    // O(E sqrt(V)) time.
+    int max_matching()
+    {
+        if (offsets.empty() || targets.size() != edges.size()) {
+            build_index();
+        }
+        while (bfs()) {
+            for (int l = 0; l < left; l++) {
+                arc[l] = offsets[l];
+            }
+            for (int l = 0; l < left; l++) {
+                if (match_left[l] == -1) {
+                    augment(l);
+                }
+            }
+        }
+        return left - count(match_left.begin(), match_left.end(), -1);
+    }
+
+private:
+    void build_index()
+    {
+        offsets.assign(left + 1, 0);
+        for (auto [l, r] : edges) {
+            offsets[l + 1]++;
+        }
+        for (int l = 0; l < left; l++) {
+            offsets[l + 1] += offsets[l];
+        }
+        targets.resize(edges.size());
+        vector<int> cursor(offsets.begin(), offsets.end() - 1);
+        for (auto [l, r] : edges) {
+            targets[cursor[l]++] = r;
+        }
+    }
+
+    // Layers left vertices by distance from the free ones. Returns true if some free
+    // right vertex is reachable, i.e. an augmenting path exists.
+    bool bfs()
+    {
+        queue.clear();
+        for (int l = 0; l < left; l++) {
+            dist[l] = match_left[l] == -1 ? 0 : -1;
+            if (dist[l] == 0) {
+                queue.push_back(l);
+            }
+        }
+        bool found = false;
+        for (size_t i = 0; i < queue.size(); i++) {
+            int l = queue[i];
+            for (int j = offsets[l]; j < offsets[l + 1]; j++) {
+                int w = match_right[targets[j]];
+                if (w == -1) {
+                    found = true;
+                }
+                else if (dist[w] == -1) {
+                    dist[w] = dist[l] + 1;
+                    queue.push_back(w);
+                }
+            }
+        }
+        return found;
+    }
+
+    // Iterative DFS for one augmenting path from the free vertex root along the BFS
+    // layers. stack[i + 1] is the left vertex matched to the right vertex at stack[i]'s
+    // current arc, so on success every stack vertex is rematched to its arc target.
+    // Dead ends get dist = -1 and are never entered again this phase.
+    bool augment(int root)
+    {
+        stack.assign(1, root);
+        while (!stack.empty()) {
+            int l = stack.back();
+            if (arc[l] == offsets[l + 1]) {
+                dist[l] = -1;
+                stack.pop_back();
+                if (!stack.empty()) {
+                    arc[stack.back()]++;
+                }
+                continue;
+            }
+            int r = targets[arc[l]];
+            int w = match_right[r];
+            if (w == -1) {
+                for (int x : stack) {
+                    int y = targets[arc[x]];
+                    match_left[x] = y;
+                    match_right[y] = x;
+                }
+                return true;
+            }
+            if (dist[w] == dist[l] + 1) {
+                stack.push_back(w);
+            }
+            else {
+                arc[l]++;
+            }
+        }
+        return false;
+    }
+};
+} // namespace cp
@@ -0,0 +1,297 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include "cp/ds/seg_tree.hpp"
+#include "cp/graph/csr_graph.hpp"
+
+namespace cp
+{
+// Centroid decomposition of a tree, built iteratively, with every vertex's distances
+// to its O(log n) centroid ancestors precomputed in one flat array.
+//
+// The centroid tree is built from a work stack of (component root, parent centroid,
+// level) tasks; each task is one BFS over the still-present part of the tree into
+// scratch buffers allocated once for the whole build. A second pass BFSes from every
+// centroid c over its component (the vertices of deeper level reachable from c) and
+// writes dist(v, c) into v's entry for level(c). Entries of v are stored contiguously,
+// top level first:
+//   dist_table[offsets[v] + L] = distance from v to its level-L centroid ancestor.
+// Total size is sum(level(v) + 1) <= n (log2 n + 1).
+//
+// Per-level layout: vertices are also numbered per level, in centroid-tree preorder,
+// so that the component of every level-L centroid c is the contiguous index range
+// component_range(c) of level L. slot_table (parallel to dist_table) holds v's index in
+// every level it belongs to. A structure per level (SegTree, Fenwick) sized
+// level_size[L] can then aggregate over any component with one range operation;
+// NearestMarked below does exactly that.
+//
+// Usage:
+//   CentroidDecomposition cd(g);      // g: undirected tree
+//   cd.dist(u, v);                    // O(log n)
+//   cd.for_each_ancestor(v, [&](int c, int level, int d, int slot) { ... });
+//
+// Reference: https://cp-algorithms.com/graph/centroid-decomposition.html
+struct CentroidDecomposition
+{
+    int n;
+    int levels = 0;          // depth of the centroid tree
+    vector<int> parent;      // centroid-tree parent, -1 for the top centroid
+    vector<int> level;       // depth in the centroid tree, 0 for the top centroid
+    vector<int> comp_size;   // size of the component v is the centroid of
+    vector<int> offsets;     // v's entries are [offsets[v], offsets[v] + level[v]]
+    vector<int> dist_table;  // distance to the ancestor at each level
+    vector<int> slot_table;  // index within each level's layout
+    vector<int> level_size;  // number of vertices at each level
+
+    // O(n log n) time, O(n log n) space. g must be an undirected tree.
+    CentroidDecomposition(const CSRGraph<> &g)
+        : n(g.n),
+          parent(n, -1),
+          level(n, -1),
+          comp_size(n)
+    {
+        assert(n >= 1 && g.num_edges() == 2 * (n - 1));
+        vector<int> queue(n), bfs_parent(n), sz(n), dist(n);
+        build_tree(g, queue, bfs_parent, sz);
+        offsets.assign(n + 1, 0);
+        for (int v = 0; v < n; v++) {
+            offsets[v + 1] = offsets[v] + level[v] + 1;
+            levels = max(levels, level[v] + 1);
+        }
+        dist_table.resize(offsets[n]);
+        slot_table.resize(offsets[n]);
+        fill_distances(g, queue, bfs_parent, dist);
+        fill_slots(queue, sz);
+    }
+
+    // Distance from v to its level-L centroid ancestor. O(1) time.
+    int dist_to_ancestor(int v, int L) const
+    {
+        assert(L >= 0 && L <= level[v]);
+        return dist_table[offsets[v] + L];
+    }
+
+    // Calls f(c, level(c), dist(v, c), index of v in level(c)'s layout) for every
+    // centroid ancestor c of v, from v itself up to the top centroid. O(log n) time.
+    template <typename F>
+    void for_each_ancestor(int v, F &&f) const
+    {
+        assert(v >= 0 && v < n);
+        for (int c = v; c != -1; c = parent[c]) {
+            int e = offsets[v] + level[c];
+            f(c, level[c], dist_table[e], slot_table[e]);
+        }
+    }
+
+    // Inclusive index range of c's component within level(c)'s layout. O(1) time.
+    pair<int, int> component_range(int c) const
+    {
+        assert(c >= 0 && c < n);
+        int first = slot_table[offsets[c] + level[c]];
+        return {first, first + comp_size[c] - 1};
+    }
+
+    // Tree distance between u and v through their deepest common centroid ancestor.
+    // O(log n) time.
+    int dist(int u, int v) const
+    {
+        assert(u >= 0 && u < n && v >= 0 && v < n);
+        int a = u, b = v;
+        while (level[a] > level[b]) {
+            a = parent[a];
+        }
+        while (level[b] > level[a]) {
+            b = parent[b];
+        }
+        while (a != b) {
+            a = parent[a];
+            b = parent[b];
+        }
+        return dist_to_ancestor(u, level[a]) + dist_to_ancestor(v, level[a]);
+    }
+
+private:
+    // Pass 1: centroid tree. level[v] == -1 marks vertices not yet removed.
+    void build_tree(const CSRGraph<> &g,
+                    vector<int> &queue,
+                    vector<int> &bfs_parent,
+                    vector<int> &sz)
+    {
+        vector<array<int, 3>> tasks = {{0, -1, 0}};
+        while (!tasks.empty()) {
+            auto [root, up, lvl] = tasks.back();
+            tasks.pop_back();
+            int k = 0;
+            queue[k++] = root;
+            bfs_parent[root] = -1;
+            for (int i = 0; i < k; i++) {
+                int v = queue[i];
+                for (int to : g.neighbors(v)) {
+                    if (level[to] == -1 && to != bfs_parent[v]) {
+                        bfs_parent[to] = v;
+                        queue[k++] = to;
+                    }
+                }
+            }
+            for (int i = k - 1; i >= 0; i--) {
+                int v = queue[i];
+                sz[v] = 1;
+                for (int to : g.neighbors(v)) {
+                    if (level[to] == -1 && to != bfs_parent[v]) {
+                        sz[v] += sz[to];
+                    }
+                }
+            }
+            int c = root;
+            for (bool moved = true; moved;) {
+                moved = false;
+                for (int to : g.neighbors(c)) {
+                    if (level[to] == -1 && to != bfs_parent[c] && 2 * sz[to] > k) {
+                        c = to;
+                        moved = true;
+                        break;
+                    }
+                }
+            }
+            parent[c] = up;
+            level[c] = lvl;
+            comp_size[c] = k;
+            for (int to : g.neighbors(c)) {
+                if (level[to] == -1) {
+                    tasks.push_back({to, c, lvl + 1});
+                }
+            }
+        }
+        assert(*min_element(level.begin(), level.end()) == 0); // connected
+    }
+
+    // Pass 2: BFS from every centroid over the vertices of deeper level.
+    void fill_distances(const CSRGraph<> &g,
+                        vector<int> &queue,
+                        vector<int> &bfs_parent,
+                        vector<int> &dist)
+    {
+        for (int c = 0; c < n; c++) {
+            int k = 0;
+            queue[k++] = c;
+            bfs_parent[c] = -1;
+            dist[c] = 0;
+            for (int i = 0; i < k; i++) {
+                int v = queue[i];
+                dist_table[offsets[v] + level[c]] = dist[v];
+                for (int to : g.neighbors(v)) {
+                    if (level[to] > level[c] && to != bfs_parent[v]) {
+                        bfs_parent[to] = v;
+                        dist[to] = dist[v] + 1;
+                        queue[k++] = to;
+                    }
+                }
+            }
+        }
+    }
+
+    // Per-level indices in centroid-tree preorder, so every component is contiguous.
+    void fill_slots(vector<int> &order, vector<int> &cursor)
+    {
+        // children of each centroid as a CSR built by counting sort on parent
+        cursor.assign(n, 0);
+        vector<int> start(n + 1, 0), children(n);
+        int top = -1;
+        for (int v = 0; v < n; v++) {
+            if (parent[v] == -1) {
+                top = v;
+            }
+            else {
+                start[parent[v] + 1]++;
+            }
+        }
+        for (int v = 0; v < n; v++) {
+            start[v + 1] += start[v];
+        }
+        for (int v = 0; v < n; v++) {
+            if (parent[v] != -1) {
+                children[start[parent[v]] + cursor[parent[v]]++] = v;
+            }
+        }
+        int k = 0;
+        vector<int> stack = {top};
+        while (!stack.empty()) {
+            int v = stack.back();
+            stack.pop_back();
+            order[k++] = v;
+            for (int i = start[v]; i < start[v + 1]; i++) {
+                stack.push_back(children[i]);
+            }
+        }
+        level_size.assign(levels, 0);
+        for (int i = 0; i < n; i++) {
+            int v = order[i];
+            for (int L = 0; L <= level[v]; L++) {
+                slot_table[offsets[v] + L] = level_size[L]++;
+            }
+        }
+    }
+};
+
+// Nearest marked vertex on a tree: mark(v), unmark(v), and query(v) = distance from
+// v to the closest marked vertex (INF if none).
+//
+// One SegTree<int, min> per centroid level over that level's layout; the leaf of v at
+// level L holds dist(v, level-L ancestor) while v is marked. The closest marked u to v
+// is found through their deepest common centroid ancestor c, so
+//   query(v) = min over ancestors c of dist(v, c) + min over c's component,
+// which is one range-min query per level. A Fenwick per level works the same way for
+// additive aggregates (counts or sums of distances to marked vertices).
+//
+// mark/unmark O(log^2 n), query O(log^2 n); memory O(n log n) in total.
+struct NearestMarked
+{
+    // A named functor rather than a lambda: a closure type in a header-defined member
+    // would trip -Wsubobject-linkage.
+    struct Min
+    {
+        constexpr int operator()(int a, int b) const
+        {
+            return min(a, b);
+        }
+    };
+    using Tree = SegTree<int, Min{}, INF>;
+
+    const CentroidDecomposition &cd;
+    vector<Tree> trees; // one per centroid level
+
+    // O(n log n) time and space. cd must outlive this object.
+    NearestMarked(const CentroidDecomposition &decomposition) : cd(decomposition)
+    {
+        trees.reserve(cd.levels);
+        for (int L = 0; L < cd.levels; L++) {
+            trees.emplace_back(vector<int>(cd.level_size[L], INF));
+        }
+    }
+
+    void mark(int v)
+    {
+        cd.for_each_ancestor(
+            v, [&](int, int L, int d, int slot) { trees[L].update(slot, d); });
+    }
+
+    void unmark(int v)
+    {
+        cd.for_each_ancestor(
+            v, [&](int, int L, int, int slot) { trees[L].update(slot, INF); });
+    }
+
+    // Distance from v to the nearest marked vertex, INF if nothing is marked.
+    int query(int v) const
+    {
+        int res = INF;
+        cd.for_each_ancestor(v, [&](int c, int L, int d, int) {
+            auto [l, r] = cd.component_range(c);
+            int best = trees[L].query(l, r);
+            if (best != INF) {
+                res = min(res, d + best);
+            }
+        });
+        return res;
+    }
+};
+} // namespace cp
@@ -0,0 +1,158 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Compressed sparse row (CSR) graph - static adjacency stored in two flat arrays.
+//
+// The out-edges of u occupy slots [offsets[u], offsets[u + 1]) of targets (and of
+// weights, when the graph is weighted). A whole graph is three allocations regardless
+// of the vertex count, and scanning the neighbors of consecutive vertices walks memory
+// sequentially, unlike vector<vector<int>> which costs one heap block (and usually one
+// cache miss) per vertex.
+//
+// I is the index type for vertices and edge slots: int for up to ~2e9 slots, ll beyond.
+// W is the weight type; unweighted graphs leave weights empty and pay nothing for it.
+//
+// Construction is an O(V + E) counting sort by source. It is stable: the neighbors of
+// u appear in the same order as their edges in the input list.
+//
+// Usage:
+//   CSRGraph<> g(n, edges);         // directed, edges: vector<pair<int, int>>
+//   CSRGraph<> g(n, edges, false);  // undirected: each edge stored both ways
+//   CSRGraph<int, ll> g(n, wedges); // weighted, wedges: vector<tuple<int, int, ll>>
+//   for (int v : g.neighbors(u)) { ... }
+//   for (int e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+//       g.targets[e], g.weights[e]; ...
+//   }
+template <typename I = int, typename W = ll>
+struct CSRGraph
+{
+    I n;
+    vector<I> offsets; // size n + 1
+    vector<I> targets; // size E
+    vector<W> weights; // size E, or empty for an unweighted graph
+
+    // O(n) time, O(n) space - graph with n vertices and no edges.
+    CSRGraph(I size = 0) : n(size), offsets(size + 1, 0) {}
+
+    // O(V + E) time, O(V + E) space - unweighted graph.
+    CSRGraph(I size, const vector<pair<I, I>> &edges, bool directed = true) : n(size)
+    {
+        build(
+            edges.size(),
+            directed,
+            [&](size_t i) { return edges[i].first; },
+            [&](size_t i) { return edges[i].second; },
+            [](size_t) { return W{}; },
+            false);
+    }
+
+    // O(V + E) time, O(V + E) space - weighted graph.
+    CSRGraph(I size, const vector<tuple<I, I, W>> &edges, bool directed = true)
+        : n(size)
+    {
+        build(
+            edges.size(),
+            directed,
+            [&](size_t i) { return get<0>(edges[i]); },
+            [&](size_t i) { return get<1>(edges[i]); },
+            [&](size_t i) { return get<2>(edges[i]); },
+            true);
+    }
+
+    I num_vertices() const
+    {
+        return n;
+    }
+
+    // Number of stored edge slots (2x the input edges for undirected graphs).
+    I num_edges() const
+    {
+        return targets.size();
+    }
+
+    bool weighted() const
+    {
+        return !weights.empty();
+    }
+
+    I degree(I u) const
+    {
+        return offsets[u + 1] - offsets[u];
+    }
+
+    // Out-neighbors of u as a view into targets. O(1) time.
+    span<const I> neighbors(I u) const
+    {
+        assert(u >= 0 && u < n);
+        return {targets.data() + offsets[u], (size_t)degree(u)};
+    }
+
+    // Weights of u's out-edges, parallel to neighbors(u). O(1) time.
+    span<const W> edge_weights(I u) const
+    {
+        assert(u >= 0 && u < n && !weights.empty());
+        return {weights.data() + offsets[u], (size_t)degree(u)};
+    }
+
+    // Graph with every edge reversed, keeping weights. O(V + E) time.
+    CSRGraph reversed() const
+    {
+        CSRGraph r;
+        r.n = n;
+        vector<I> sources(targets.size());
+        for (I u = 0; u < n; u++) {
+            fill(sources.begin() + offsets[u], sources.begin() + offsets[u + 1], u);
+        }
+        r.build(
+            targets.size(),
+            true,
+            [&](size_t e) { return targets[e]; },
+            [&](size_t e) { return sources[e]; },
+            [&](size_t e) { return weights.empty() ? W{} : weights[e]; },
+            !weights.empty());
+        return r;
+    }
+
+private:
+    // Counting sort by source. offsets[u] first counts u's edges, is turned into the
+    // end of u's range by a prefix sum, and then walks back to the start of the range
+    // as edges are placed from the last input edge to the first (which keeps the sort
+    // stable without a separate cursor array).
+    template <typename Src, typename Dst, typename Wt>
+    void build(size_t m, bool directed, Src src, Dst dst, Wt wt, bool has_weights)
+    {
+        size_t slots = directed ? m : 2 * m;
+        assert(slots <= (size_t)numeric_limits<I>::max());
+        offsets.assign(n + 1, 0);
+        targets.resize(slots);
+        weights.resize(has_weights ? slots : 0);
+        for (size_t i = 0; i < m; i++) {
+            I u = src(i), v = dst(i);
+            assert(u >= 0 && u < n && v >= 0 && v < n);
+            offsets[u]++;
+            if (!directed) {
+                offsets[v]++;
+            }
+        }
+        for (I u = 1; u <= n; u++) {
+            offsets[u] += offsets[u - 1];
+        }
+        auto place = [&](I u, I v, size_t i) {
+            I e = --offsets[u];
+            targets[e] = v;
+            if (has_weights) {
+                weights[e] = wt(i);
+            }
+        };
+        for (size_t i = m; i-- > 0;) {
+            I u = src(i), v = dst(i);
+            if (!directed) {
+                place(v, u, i);
+            }
+            place(u, v, i);
+        }
+    }
+};
+} // namespace cp
@@ -0,0 +1,316 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include "cp/graph/csr_graph.hpp"
+
+namespace cp
+{
+// Indexed D-ary min-heap over vertex ids with decrease-key.
+//
+// Each vertex is in the heap at most once; pos[v] is its slot or -1. Entries store the
+// key next to the vertex, so sifting compares contiguous memory. With D = 4 the tree is
+// half as deep as a binary heap and the four children of a slot share a cache line,
+// which makes pop cheaper at the cost of a few more comparisons per level.
+//
+// Usage:
+//   DaryHeap<ll> h;
+//   h.resize(n);           // once, before the first push
+//   h.push(v, key);        // insert, or lower v's key if already present
+//   auto [key, v] = h.pop();
+//   h.clear();             // O(size) - only resets the vertices still queued
+template <typename W, int D = 4>
+struct DaryHeap
+{
+    using key_type = W;
+
+    vector<pair<W, int>> heap;
+    vector<int> pos; // slot of each vertex, -1 if not queued
+
+    void resize(int n)
+    {
+        pos.assign(n, -1);
+    }
+
+    bool empty() const
+    {
+        return heap.empty();
+    }
+
+    int size() const
+    {
+        return heap.size();
+    }
+
+    // Inserts v with key, or decreases v's key if it is queued with a larger one.
+    // O(log_D n) time.
+    void push(int v, W key)
+    {
+        int i = pos[v];
+        if (i == -1) {
+            heap.push_back({key, v});
+            sift_up(heap.size() - 1);
+        }
+        else if (key < heap[i].first) {
+            heap[i].first = key;
+            sift_up(i);
+        }
+    }
+
+    // Removes and returns the entry with the smallest key. O(D log_D n) time.
+    pair<W, int> pop()
+    {
+        assert(!heap.empty());
+        pair<W, int> top = heap[0];
+        pos[top.second] = -1;
+        pair<W, int> last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            sift_down(0);
+        }
+        return top;
+    }
+
+    // Empties the heap, touching only the vertices still queued. O(size) time.
+    void clear()
+    {
+        for (auto &e : heap) {
+            pos[e.second] = -1;
+        }
+        heap.clear();
+    }
+
+private:
+    void sift_up(int i)
+    {
+        pair<W, int> e = heap[i];
+        while (i > 0) {
+            int p = (i - 1) / D;
+            if (!(e.first < heap[p].first)) {
+                break;
+            }
+            heap[i] = heap[p];
+            pos[heap[i].second] = i;
+            i = p;
+        }
+        heap[i] = e;
+        pos[e.second] = i;
+    }
+
+    void sift_down(int i)
+    {
+        int n = heap.size();
+        pair<W, int> e = heap[i];
+        while (true) {
+            int c = i * D + 1;
+            if (c >= n) {
+                break;
+            }
+            int best = c;
+            for (int j = c + 1; j < min(c + D, n); j++) {
+                if (heap[j].first < heap[best].first) {
+                    best = j;
+                }
+            }
+            if (!(heap[best].first < e.first)) {
+                break;
+            }
+            heap[i] = heap[best];
+            pos[heap[i].second] = i;
+            i = best;
+        }
+        heap[i] = e;
+        pos[e.second] = i;
+    }
+};
+
+// Radix heap - monotone priority queue for non-negative integer keys.
+//
+// Keys pushed must never be smaller than the last popped key, which Dijkstra with
+// non-negative weights guarantees. An entry with key x sits in bucket bit_width(x ^
+// last), so bucket 0 holds keys equal to last and bucket i keys that first differ from
+// last at bit i - 1. pop refills bucket 0 by redistributing the lowest non-empty
+// bucket around its minimum; every entry only moves to strictly lower buckets, giving
+// O(log C) amortized per entry for keys up to C, with plain vector appends and no
+// comparisons between entries.
+//
+// There is no decrease-key: a vertex is pushed again with its new key and the caller
+// skips stale entries on pop. Bucket vectors keep their capacity across clear().
+//
+// Reference: Ahuja, Mehlhorn, Orlin, Tarjan - "Faster algorithms for the shortest
+// path problem" (1990)
+template <typename W>
+struct RadixHeap
+{
+    static_assert(is_integral_v<W>, "radix heap needs integral keys");
+    using key_type = W;
+    using U = make_unsigned_t<W>;
+    static constexpr int BITS = 8 * sizeof(U);
+
+    array<vector<pair<U, int>>, BITS + 1> buckets;
+    U last = 0;
+    size_t count = 0;
+
+    void resize(int) {}
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    int size() const
+    {
+        return count;
+    }
+
+    // Queues v with key >= the last popped key. O(1) time.
+    void push(int v, W key)
+    {
+        assert(key >= 0 && (U)key >= last);
+        buckets[bucket((U)key)].push_back({(U)key, v});
+        count++;
+    }
+
+    // Removes and returns an entry with the smallest key. O(log C) amortized time.
+    pair<W, int> pop()
+    {
+        assert(count > 0);
+        if (buckets[0].empty()) {
+            int i = 1;
+            while (buckets[i].empty()) {
+                i++;
+            }
+            last = buckets[i][0].first;
+            for (auto &e : buckets[i]) {
+                last = min(last, e.first);
+            }
+            for (auto e : buckets[i]) {
+                buckets[bucket(e.first)].push_back(e);
+            }
+            buckets[i].clear();
+        }
+        auto [key, v] = buckets[0].back();
+        buckets[0].pop_back();
+        count--;
+        return {(W)key, v};
+    }
+
+    // Empties the heap and resets the monotone floor to 0. O(BITS + size) time.
+    void clear()
+    {
+        for (auto &b : buckets) {
+            b.clear();
+        }
+        last = 0;
+        count = 0;
+    }
+
+private:
+    int bucket(U key) const
+    {
+        return bit_width(key ^ last);
+    }
+};
+
+// Single-source shortest paths on a CSRGraph with non-negative weights, reusable
+// across many sources.
+//
+// Heap is DaryHeap<W> (decrease-key) or RadixHeap<W> (monotone, integer weights); any
+// type with key_type, resize, empty, push, pop and clear works. dist, parent and the
+// heap are allocated once. Every run records the vertices it reached, and the next
+// run resets only those, so a query that settles k vertices costs O(k log k) plus the
+// edges scanned - never O(V) - which is what makes millions of local queries on one
+// large graph cheap.
+//
+// Usage:
+//   Dijkstra<DaryHeap<ll>> sp(g);   // g: CSRGraph<int, ll>, weighted
+//   sp.run(s);                      // full run
+//   sp.dist[v];                     // UNREACHED if v is not reachable
+//   sp.run(s, t);                   // stops once t is settled
+//   vector<int> p = sp.path(t);     // s ... t, empty if unreachable
+template <typename Heap>
+struct Dijkstra
+{
+    using W = Heap::key_type;
+    static constexpr W UNREACHED = numeric_limits<W>::max();
+
+    const CSRGraph<int, W> &g;
+    vector<W> dist;      // tentative distances of the last run
+    vector<int> parent;  // predecessor on a shortest path, -1 for the source
+    vector<int> touched; // vertices whose dist the last run set
+    Heap heap;
+    int source = -1;
+
+    // O(V + E) time, O(V) space - checks that every weight is non-negative.
+    Dijkstra(const CSRGraph<int, W> &graph)
+        : g(graph),
+          dist(g.n, UNREACHED),
+          parent(g.n, -1)
+    {
+        assert(g.weighted() || g.num_edges() == 0);
+        assert(all_of(g.weights.begin(), g.weights.end(), [](W w) { return w >= 0; }));
+        heap.resize(g.n);
+    }
+
+    // Computes distances from s. With target != -1 the run stops as soon as target
+    // is settled; dist[target] is then final, other touched distances may only be
+    // upper bounds. O((k + e) log k) time for k vertices reached and e edges scanned.
+    void run(int s, int target = -1)
+    {
+        assert(s >= 0 && s < g.n && target >= -1 && target < g.n);
+        reset();
+        source = s;
+        dist[s] = 0;
+        touched.push_back(s);
+        heap.push(s, 0);
+        while (!heap.empty()) {
+            auto [d, v] = heap.pop();
+            if (d > dist[v]) {
+                continue; // stale entry (heaps without decrease-key)
+            }
+            if (v == target) {
+                break;
+            }
+            for (int e = g.offsets[v]; e < g.offsets[v + 1]; e++) {
+                int to = g.targets[e];
+                W nd = d + g.weights[e];
+                if (nd < dist[to]) {
+                    if (dist[to] == UNREACHED) {
+                        touched.push_back(to);
+                    }
+                    dist[to] = nd;
+                    parent[to] = v;
+                    heap.push(to, nd);
+                }
+            }
+        }
+    }
+
+    // Restores dist and parent of the vertices the last run reached. O(touched) time.
+    void reset()
+    {
+        for (int v : touched) {
+            dist[v] = UNREACHED;
+            parent[v] = -1;
+        }
+        touched.clear();
+        heap.clear();
+        source = -1;
+    }
+
+    // Vertices of a shortest path from the last source to t, or empty if t was not
+    // reached. O(path length) time.
+    vector<int> path(int t) const
+    {
+        assert(t >= 0 && t < g.n);
+        if (dist[t] == UNREACHED) {
+            return {};
+        }
+        vector<int> res;
+        for (int v = t; v != -1; v = parent[v]) {
+            res.push_back(v);
+        }
+        reverse(res.begin(), res.end());
+        return res;
+    }
+};
+} // namespace cp
@@ -0,0 +1,207 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include "cp/ds/range_seg_tree.hpp"
+#include "cp/graph/csr_graph.hpp"
+
+namespace cp
+{
+// Heavy-light decomposition - lays out a rooted tree so that every root-to-leaf path
+// crosses O(log n) heavy paths, each occupying a contiguous range of positions.
+//
+// Positions are a DFS preorder that visits the heavy child (largest subtree) first, so
+//   - every heavy path is a contiguous range starting at its head, and
+//   - every subtree is the contiguous range [pos[v], pos[v] + sz[v]).
+// A path u-v therefore maps to O(log n) ranges of one array, which any range structure
+// (SegTree, RangeSegTree, Fenwick) can serve.
+//
+// Both passes are iterative with an explicit stack, so chains of 1e7 vertices do not
+// overflow the call stack.
+//
+// Usage:
+//   HLD hld(g, root);                                         // g: undirected tree
+//   hld.for_each_path_range(u, v, [&](int l, int r) { ... }); // inclusive ranges
+//   auto [l, r] = hld.subtree_range(v);
+//
+// Reference: https://cp-algorithms.com/graph/hld.html
+struct HLD
+{
+    int n;
+    vector<int> parent; // -1 for the root
+    vector<int> depth;
+    vector<int> sz;    // subtree size
+    vector<int> heavy; // child with the largest subtree, -1 for leaves
+    vector<int> head;  // topmost vertex of v's heavy path
+    vector<int> pos;   // position of v in the layout
+    vector<int> order; // order[pos[v]] == v
+
+    // O(n) time, O(n) space. g must be an undirected tree (each edge stored both ways).
+    HLD(const CSRGraph<> &g, int root = 0)
+        : n(g.n),
+          parent(n, -1),
+          depth(n, 0),
+          sz(n, 1),
+          heavy(n, -1),
+          head(n),
+          pos(n),
+          order(n)
+    {
+        assert(root >= 0 && root < n);
+        assert(g.num_edges() == 2 * (n - 1));
+        // Pass 1: parents and depths in preorder, then sizes bottom-up.
+        vector<int> stack = {root};
+        int cnt = 0;
+        while (!stack.empty()) {
+            int v = stack.back();
+            stack.pop_back();
+            order[cnt++] = v;
+            for (int to : g.neighbors(v)) {
+                if (to != parent[v]) {
+                    parent[to] = v;
+                    depth[to] = depth[v] + 1;
+                    stack.push_back(to);
+                }
+            }
+        }
+        assert(cnt == n); // connected
+        for (int i = n - 1; i > 0; i--) {
+            int v = order[i], p = parent[v];
+            sz[p] += sz[v];
+            if (heavy[p] == -1 || sz[v] > sz[heavy[p]]) {
+                heavy[p] = v;
+            }
+        }
+        // Pass 2: preorder with the heavy child popped right after its parent.
+        stack = {root};
+        head[root] = root;
+        cnt = 0;
+        while (!stack.empty()) {
+            int v = stack.back();
+            stack.pop_back();
+            pos[v] = cnt;
+            order[cnt++] = v;
+            for (int to : g.neighbors(v)) {
+                if (to != parent[v] && to != heavy[v]) {
+                    head[to] = to;
+                    stack.push_back(to);
+                }
+            }
+            if (heavy[v] != -1) {
+                head[heavy[v]] = head[v];
+                stack.push_back(heavy[v]);
+            }
+        }
+    }
+
+    // Lowest common ancestor of u and v. O(log n) time.
+    int lca(int u, int v) const
+    {
+        for (; head[u] != head[v]; u = parent[head[u]]) {
+            if (depth[head[u]] < depth[head[v]]) {
+                swap(u, v);
+            }
+        }
+        return depth[u] < depth[v] ? u : v;
+    }
+
+    // Calls f(l, r) for O(log n) inclusive position ranges that exactly cover the path
+    // u-v. With exclude_lca the LCA's position is left out, which is what values stored
+    // on edges (at the child endpoint) need. Ranges come in no particular order.
+    template <typename F>
+    void for_each_path_range(int u, int v, F &&f, bool exclude_lca = false) const
+    {
+        assert(u >= 0 && u < n && v >= 0 && v < n);
+        for (; head[u] != head[v]; u = parent[head[u]]) {
+            if (depth[head[u]] < depth[head[v]]) {
+                swap(u, v);
+            }
+            f(pos[head[u]], pos[u]);
+        }
+        if (depth[u] > depth[v]) {
+            swap(u, v);
+        }
+        int l = pos[u] + exclude_lca;
+        if (l <= pos[v]) {
+            f(l, pos[v]);
+        }
+    }
+
+    // Inclusive position range of v's subtree. O(1) time.
+    pair<int, int> subtree_range(int v) const
+    {
+        assert(v >= 0 && v < n);
+        return {pos[v], pos[v] + sz[v] - 1};
+    }
+};
+
+// RangeSegTree over an HLD layout: path and subtree updates/queries on vertex values
+// for any RangeSegTree Policy.
+//
+// path_query combines the O(log n) ranges in no particular order, so Policy::combine
+// must be commutative (true for every policy in range_seg_tree.hpp).
+//
+// Usage:
+//   HLDRangeSegTree<LongSumAddPolicy> t(g, values); // values[v] = initial value of v
+//   t.path_update(u, v, 5);                          // O(log^2 n)
+//   t.path_query(u, v);                              // O(log^2 n)
+//   t.subtree_update(v, 5);                          // O(log n)
+//   t.subtree_query(v);                              // O(log n)
+template <typename Policy>
+struct HLDRangeSegTree
+{
+    using T = Policy::T;
+    using L = Policy::L;
+
+    HLD hld;
+    RangeSegTree<Policy> st;
+
+    // O(n) time, O(n) space - every vertex starts at Policy::tree_init.
+    HLDRangeSegTree(const CSRGraph<> &g, int root = 0) : hld(g, root), st(g.n) {}
+
+    // O(n) time, O(n) space - values[v] is the initial value of vertex v.
+    HLDRangeSegTree(const CSRGraph<> &g, const vector<T> &values, int root = 0)
+        : hld(g, root),
+          st(permuted(values))
+    {
+    }
+
+    // Applies val to every vertex on the path u-v. O(log^2 n) time.
+    void path_update(int u, int v, L val)
+    {
+        hld.for_each_path_range(u, v, [&](int l, int r) { st.update(l, r, val); });
+    }
+
+    // Combined value over the path u-v. O(log^2 n) time.
+    T path_query(int u, int v)
+    {
+        T res = Policy::query_oob;
+        hld.for_each_path_range(
+            u, v, [&](int l, int r) { res = Policy::combine(res, st.query(l, r)); });
+        return res;
+    }
+
+    // Applies val to every vertex in v's subtree. O(log n) time.
+    void subtree_update(int v, L val)
+    {
+        auto [l, r] = hld.subtree_range(v);
+        st.update(l, r, val);
+    }
+
+    // Combined value over v's subtree. O(log n) time.
+    T subtree_query(int v)
+    {
+        auto [l, r] = hld.subtree_range(v);
+        return st.query(l, r);
+    }
+
+private:
+    vector<T> permuted(const vector<T> &values) const
+    {
+        assert((int)values.size() == hld.n);
+        vector<T> a(hld.n);
+        for (int v = 0; v < hld.n; v++) {
+            a[hld.pos[v]] = values[v];
+        }
+        return a;
+    }
+};
+} // namespace cp
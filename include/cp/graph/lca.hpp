@@ -0,0 +1,164 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include "cp/ds/dsu.hpp"
+#include "cp/ds/sparse_table.hpp"
+#include "cp/graph/csr_graph.hpp"
+
+namespace cp
+{
+// Lowest common ancestor with O(n) preprocessing and O(1) queries.
+//
+// Uses the DFS-order form of the Euler tour reduction: with vertices numbered in
+// preorder (tin), for u != v and tin[u] < tin[v] the LCA is the parent of the vertex
+// of minimum depth among preorder positions (tin[u], tin[v]]. Equivalently, storing
+// up[i] = tin[parent[order[i]]] for every position i, the LCA is order[min(up[tin[u]
+// + 1 .. tin[v]])]. That is an RMQ over n ints instead of the 2n - 1 (depth, vertex)
+// pairs of the classic tour.
+//
+// The RMQ is a BlockSparseTable (cp/ds/sparse_table.hpp): 64-wide blocks with an
+// in-block bitmask per position and a sparse table over the block minima, so a query
+// is two in-block lookups plus two sparse table reads and never loops.
+//
+// Usage:
+//   LCA lca(g, root);        // g: undirected tree
+//   lca.query(u, v);         // O(1)
+//   lca.dist(u, v);          // edges on the path u-v
+//   lca.query(queries, out); // batched: out[i] = LCA of queries[i]
+//
+// Reference: https://cp-algorithms.com/graph/lca_farachcoltonbender.html
+struct LCA
+{
+    int n;
+    vector<int> tin;   // preorder position of each vertex
+    vector<int> order; // order[tin[v]] == v
+    vector<int> depth; // distance to the root
+    // RMQ over up[i] = tin of the parent of order[i] (up[0] unused)
+    BlockSparseTable<int> rmq;
+
+    // O(n) time, O(n) space. g must be an undirected tree (each edge stored both ways).
+    LCA(const CSRGraph<> &g, int root = 0)
+        : n(g.n), tin(n), order(n), depth(n, 0), rmq({})
+    {
+        assert(root >= 0 && root < n);
+        assert(g.num_edges() == 2 * (n - 1));
+        // Iterative preorder. Popping a vertex and pushing all its children still
+        // yields a valid DFS preorder: a child's subtree is finished before any
+        // sibling pushed earlier is popped.
+        vector<int> parent(n, -1), up(n, 0);
+        vector<int> stack = {root};
+        int cnt = 0;
+        while (!stack.empty()) {
+            int v = stack.back();
+            stack.pop_back();
+            tin[v] = cnt;
+            order[cnt++] = v;
+            if (parent[v] != -1) {
+                up[tin[v]] = tin[parent[v]];
+            }
+            for (int to : g.neighbors(v)) {
+                if (to != parent[v]) {
+                    parent[to] = v;
+                    depth[to] = depth[v] + 1;
+                    stack.push_back(to);
+                }
+            }
+        }
+        assert(cnt == n); // connected
+        rmq = BlockSparseTable<int>(std::move(up));
+    }
+
+    // Lowest common ancestor of u and v. O(1) time.
+    int query(int u, int v) const
+    {
+        assert(u >= 0 && u < n && v >= 0 && v < n);
+        if (u == v) {
+            return u;
+        }
+        int l = tin[u], r = tin[v];
+        if (l > r) {
+            swap(l, r);
+        }
+        return order[rmq.query(l + 1, r)];
+    }
+
+    // Number of edges on the path u-v. O(1) time.
+    int dist(int u, int v) const
+    {
+        return depth[u] + depth[v] - 2 * depth[query(u, v)];
+    }
+
+    // out[i] = LCA of queries[i]. The tin lookups of queries a few slots ahead are
+    // prefetched, so independent queries overlap their cache misses instead of paying
+    // them one after another. O(queries.size()) time.
+    void query(span<const pair<int, int>> queries, span<int> out) const
+    {
+        assert(out.size() >= queries.size());
+        constexpr size_t ahead = 16;
+        for (size_t i = 0; i < queries.size(); i++) {
+            if (i + ahead < queries.size()) {
+                __builtin_prefetch(&tin[queries[i + ahead].first]);
+                __builtin_prefetch(&tin[queries[i + ahead].second]);
+            }
+            out[i] = query(queries[i].first, queries[i].second);
+        }
+    }
+};
+
+// Offline LCA (Tarjan) - answers all queries in one DFS over the tree with a DSU, in
+// O((n + q) a(n)) time. out[i] receives the LCA of queries[i].
+//
+// When v is finished, every vertex already finished lies in a DSU set whose recorded
+// ancestor is the deepest vertex on the current root path above it, which is the LCA
+// with v. The DFS is iterative, and the queries are bucketed per endpoint with the
+// CSR counting sort (weight = query index).
+//
+// Reference: https://cp-algorithms.com/graph/lca_tarjan.html
+inline void tarjan_lca(const CSRGraph<> &g,
+                       span<const pair<int, int>> queries,
+                       span<int> out,
+                       int root = 0)
+{
+    int n = g.n;
+    assert(root >= 0 && root < n);
+    assert(g.num_edges() == 2 * (n - 1));
+    assert(out.size() >= queries.size());
+    vector<tuple<int, int, int>> qedges(queries.size());
+    for (size_t i = 0; i < queries.size(); i++) {
+        qedges[i] = {queries[i].first, queries[i].second, (int)i};
+    }
+    CSRGraph<int, int> at(n, qedges, false);
+
+    DSU dsu(n);
+    vector<int> ancestor(n), parent(n, -1), edge(n);
+    vector<char> done(n, 0);
+    vector<int> stack = {root};
+    ancestor[root] = root;
+    edge[root] = g.offsets[root];
+    while (!stack.empty()) {
+        int v = stack.back();
+        if (edge[v] < g.offsets[v + 1]) {
+            int to = g.targets[edge[v]++];
+            if (to != parent[v]) {
+                parent[to] = v;
+                ancestor[to] = to;
+                edge[to] = g.offsets[to];
+                stack.push_back(to);
+            }
+            continue;
+        }
+        stack.pop_back();
+        done[v] = 1;
+        for (int e = at.offsets[v]; e < at.offsets[v + 1]; e++) {
+            int u = at.targets[e];
+            if (done[u]) {
+                out[at.weights[e]] = ancestor[dsu.find(u)];
+            }
+        }
+        if (parent[v] != -1) {
+            int p = parent[v];
+            dsu.merge(p, v);
+            ancestor[dsu.find(p)] = p;
+        }
+    }
+}
+} // namespace cp
@@ -0,0 +1,145 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include "cp/graph/csr_graph.hpp"
+
+namespace cp
+{
+// Bridges, articulation points, 2-edge-connected and biconnected components of an
+// undirected CSRGraph (each edge stored both ways), from one iterative DFS.
+//
+// low[v] is the smallest tin reachable from v's DFS subtree using at most one back
+// edge. For a tree edge p - c:
+//   - low[c] > tin[p]:  p - c is a bridge, and c's 2-edge-connected component is
+//                       complete;
+//   - low[c] >= tin[p]: p separates c's subtree, so p is an articulation point (the
+//                       root only when it has 2+ DFS children), and c's subtree part
+//                       plus p is a biconnected component.
+// Each vertex skips the edge back to its DFS parent only once, so parallel edges
+// count as back edges and are never bridges.
+//
+// The DFS uses an explicit call stack and per-vertex edge cursors, so 1e7-vertex
+// chains do not recurse. Results are flat arrays:
+//   two_edge_comp[v]   2-edge-connected component id of v
+//   articulation[v]    1 if v is an articulation point
+//   bridges            (parent, child) pairs
+//   bcc(i)             vertices of biconnected component i, stored CSR-style in
+//                      bcc_offsets / bcc_vertices (an isolated vertex is its own
+//                      component; articulation points appear in several)
+//
+// Usage:
+//   Lowlink lk(g);
+//   for (auto [u, v] : lk.bridges) { ... }
+//   for (int i = 0; i < lk.num_bcc(); i++) for (int v : lk.bcc(i)) { ... }
+//
+// Reference: https://cp-algorithms.com/graph/bridge-searching.html
+struct Lowlink
+{
+    int n;
+    vector<int> tin, low;
+    vector<char> articulation;
+    vector<pair<int, int>> bridges;
+    vector<int> two_edge_comp;
+    int two_edge_count = 0;
+    vector<int> bcc_offsets = {0};
+    vector<int> bcc_vertices;
+
+    // O(V + E) time, O(V) space.
+    Lowlink(const CSRGraph<> &g)
+        : n(g.n),
+          tin(n, -1),
+          low(n),
+          articulation(n, 0),
+          two_edge_comp(n, -1)
+    {
+        vector<int> parent(n, -1), cursor(n), call, two_edge_stack, vertex_stack;
+        vector<char> skipped(n, 0); // parent edge already skipped once
+        int timer = 0;
+        auto enter = [&](int v) {
+            tin[v] = low[v] = timer++;
+            cursor[v] = g.offsets[v];
+            call.push_back(v);
+            two_edge_stack.push_back(v);
+            vertex_stack.push_back(v);
+        };
+        auto close_two_edge = [&](int v) {
+            int w;
+            do {
+                w = two_edge_stack.back();
+                two_edge_stack.pop_back();
+                two_edge_comp[w] = two_edge_count;
+            } while (w != v);
+            two_edge_count++;
+        };
+        for (int root = 0; root < n; root++) {
+            if (tin[root] != -1) {
+                continue;
+            }
+            int root_children = 0;
+            enter(root);
+            while (!call.empty()) {
+                int v = call.back();
+                if (cursor[v] < g.offsets[v + 1]) {
+                    int to = g.targets[cursor[v]++];
+                    if (to == parent[v] && !skipped[v]) {
+                        skipped[v] = 1;
+                    }
+                    else if (tin[to] == -1) {
+                        parent[to] = v;
+                        enter(to);
+                    }
+                    else {
+                        low[v] = min(low[v], tin[to]);
+                    }
+                    continue;
+                }
+                call.pop_back();
+                int p = parent[v];
+                if (p == -1) {
+                    continue;
+                }
+                low[p] = min(low[p], low[v]);
+                if (low[v] > tin[p]) {
+                    bridges.push_back({p, v});
+                    close_two_edge(v);
+                }
+                if (low[v] >= tin[p]) {
+                    if (p == root) {
+                        root_children++;
+                    }
+                    else {
+                        articulation[p] = 1;
+                    }
+                    int w;
+                    do {
+                        w = vertex_stack.back();
+                        vertex_stack.pop_back();
+                        bcc_vertices.push_back(w);
+                    } while (w != v);
+                    bcc_vertices.push_back(p);
+                    bcc_offsets.push_back(bcc_vertices.size());
+                }
+            }
+            articulation[root] = root_children > 1;
+            close_two_edge(root);
+            vertex_stack.pop_back(); // root
+            if (root_children == 0) {
+                bcc_vertices.push_back(root);
+                bcc_offsets.push_back(bcc_vertices.size());
+            }
+        }
+    }
+
+    int num_bcc() const
+    {
+        return bcc_offsets.size() - 1;
+    }
+
+    // Vertices of biconnected component i. O(1) time.
+    span<const int> bcc(int i) const
+    {
+        assert(i >= 0 && i < num_bcc());
+        int len = bcc_offsets[i + 1] - bcc_offsets[i];
+        return {bcc_vertices.data() + bcc_offsets[i], (size_t)len};
+    }
+};
+} // namespace cp
@@ -0,0 +1,183 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Dinic's maximum flow with flat edge arrays.
+//
+// Edge e and its reverse are stored at e and e ^ 1 of the same arrays (to, cap), so
+// pushing flow is cap[e] -= f, cap[e ^ 1] += f with no pointer chasing. When flow is
+// computed, the edge ids are bucketed by source into a CSR index (adj_offsets, adj),
+// so a vertex's arcs are one contiguous run of ints.
+//
+// Each phase builds the BFS level graph with a reusable queue, then finds a blocking
+// flow with an iterative DFS: an explicit path of edge ids plus current-arc pointers
+// (arc[v]) that only move forward within a phase, so every arc is discarded at most
+// once per phase. Nothing recurses, so deep level graphs (long chains with 1e6+
+// vertices) are safe.
+//
+// O(V^2 E) in general, O(E sqrt(V)) on unit-capacity bipartite networks.
+//
+// Usage:
+//   Dinic<ll> f(n);
+//   int e = f.add_edge(u, v, cap);   // returns the edge id
+//   ll flow = f.max_flow(s, t);
+//   f.flow(e);                       // flow on edge e
+//   f.source_side(v);                // v on the s side of a minimum cut
+//
+// max_flow may be called again after adding more edges; it augments the current flow.
+//
+// Reference: https://cp-algorithms.com/graph/dinic.html
+template <typename Cap = ll>
+struct Dinic
+{
+    int n;
+    vector<int> to;          // head of each edge; to[e ^ 1] is its tail
+    vector<Cap> cap;         // residual capacity
+    vector<Cap> original;    // capacity as added
+    vector<int> adj_offsets; // adj[adj_offsets[v] .. adj_offsets[v + 1]) leave v
+    vector<int> adj;         // edge ids grouped by tail
+    vector<int> level, arc, queue, path;
+
+    // O(n) time, O(n) space.
+    Dinic(int size) : n(size), level(size), arc(size)
+    {
+        queue.reserve(size);
+    }
+
+    // Adds u -> v with capacity c (and v -> u with rev_cap, 0 for a directed edge).
+    // Returns the id of the u -> v edge; the reverse edge is id ^ 1. O(1) amortized.
+    int add_edge(int u, int v, Cap c, Cap rev_cap = 0)
+    {
+        assert(u >= 0 && u < n && v >= 0 && v < n && c >= 0 && rev_cap >= 0);
+        int e = to.size();
+        to.push_back(v);
+        to.push_back(u);
+        cap.push_back(c);
+        cap.push_back(rev_cap);
+        original.push_back(c);
+        original.push_back(rev_cap);
+        return e;
+    }
+
+    // Flow currently on edge e (negative if it runs against e). O(1) time.
+    Cap flow(int e) const
+    {
+        return original[e] - cap[e];
+    }
+
+    // Pushes as much additional flow from s to t as possible and returns it.
+    // O(V^2 E) time.
+    Cap max_flow(int s, int t)
+    {
+        assert(s >= 0 && s < n && t >= 0 && t < n && s != t);
+        if (adj_offsets.empty() || adj.size() != to.size()) {
+            build_index();
+        }
+        Cap total = 0;
+        while (bfs(s, t)) {
+            for (int v = 0; v < n; v++) {
+                arc[v] = adj_offsets[v];
+            }
+            total += blocking_flow(s, t);
+        }
+        return total;
+    }
+
+    // After max_flow(s, t): true if v is reachable from s in the residual graph, i.e.
+    // on the source side of a minimum cut. O(1) time.
+    bool source_side(int v) const
+    {
+        return level[v] != -1;
+    }
+
+private:
+    // Counting sort of edge ids by tail into adj_offsets / adj.
+    void build_index()
+    {
+        adj_offsets.assign(n + 1, 0);
+        for (size_t e = 0; e < to.size(); e++) {
+            adj_offsets[to[e ^ 1] + 1]++;
+        }
+        for (int v = 0; v < n; v++) {
+            adj_offsets[v + 1] += adj_offsets[v];
+        }
+        adj.resize(to.size());
+        vector<int> cursor(adj_offsets.begin(), adj_offsets.end() - 1);
+        for (int e = 0; e < (int)to.size(); e++) {
+            adj[cursor[to[e ^ 1]]++] = e;
+        }
+    }
+
+    // Level graph from s. Returns true if t is reachable.
+    bool bfs(int s, int t)
+    {
+        fill(level.begin(), level.end(), -1);
+        queue.clear();
+        queue.push_back(s);
+        level[s] = 0;
+        for (size_t i = 0; i < queue.size(); i++) {
+            int v = queue[i];
+            for (int j = adj_offsets[v]; j < adj_offsets[v + 1]; j++) {
+                int e = adj[j];
+                if (cap[e] > 0 && level[to[e]] == -1) {
+                    level[to[e]] = level[v] + 1;
+                    queue.push_back(to[e]);
+                }
+            }
+        }
+        return level[t] != -1;
+    }
+
+    // Iterative DFS: extends path (edge ids from s) along admissible arcs; at t it
+    // augments by the bottleneck and cuts the path back to the first saturated edge;
+    // at a dead end it retreats one edge and advances the parent's current arc.
+    Cap blocking_flow(int s, int t)
+    {
+        Cap total = 0;
+        path.clear();
+        int v = s;
+        while (true) {
+            if (v == t) {
+                Cap f = cap[path[0]];
+                for (int e : path) {
+                    f = min(f, cap[e]);
+                }
+                size_t cut = path.size();
+                for (size_t i = 0; i < path.size(); i++) {
+                    int e = path[i];
+                    cap[e] -= f;
+                    cap[e ^ 1] += f;
+                    if (cap[e] == 0 && cut == path.size()) {
+                        cut = i;
+                    }
+                }
+                total += f;
+                v = to[path[cut] ^ 1];
+                path.resize(cut);
+                continue;
+            }
+            int end = adj_offsets[v + 1];
+            while (arc[v] < end) {
+                int e = adj[arc[v]];
+                if (cap[e] > 0 && level[to[e]] == level[v] + 1) {
+                    break;
+                }
+                arc[v]++;
+            }
+            if (arc[v] < end) {
+                int e = adj[arc[v]];
+                path.push_back(e);
+                v = to[e];
+                continue;
+            }
+            if (path.empty()) {
+                return total;
+            }
+            v = to[path.back() ^ 1];
+            path.pop_back();
+            arc[v]++;
+        }
+    }
+};
+} // namespace cp
@@ -0,0 +1,181 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include "cp/core/parallel.hpp"
+#include "cp/ds/dsu.hpp"
+
+namespace cp
+{
+// Minimum spanning forest over an edge list of (u, v, w) tuples with integral weights.
+//
+//   kruskal(n, edges, out)           radix-sorts the edges by weight, then scans them
+//                                    with a DSU. O(E * sizeof(W) + E a(n)) time.
+//   boruvka(n, edges, threads, out)  multithreaded Boruvka rounds over a ConcurrentDSU:
+//                                    every component picks its cheapest outgoing edge
+//                                    in parallel, then all picks are merged in
+//                                    parallel. O(log V) rounds of O(E / threads) work.
+//
+// Both return the total weight and the number of chosen edges (n - components). If out
+// is non-empty the indices of the chosen edges (into edges) are written to it; it must
+// then hold at least n - 1 ints. kruskal writes them in weight order, boruvka in no
+// particular order.
+//
+// Ties are broken by edge index in both algorithms, so with distinct (weight, index)
+// keys they select the same forest. Boruvka needs a strict total order on edges: with
+// plain weight ties two components could pick different equal edges and close a cycle.
+template <typename W>
+struct MSTResult
+{
+    W weight;
+    int edges;
+};
+
+// Returns edge indices sorted by weight (stable), using an LSD radix sort on 8-bit
+// digits of the order-preserving unsigned image of W. Digit passes where every key
+// has the same byte are skipped, so small weights cost one or two passes.
+// O(E * sizeof(W)) time, O(E) space.
+template <typename W>
+vector<int> sort_edges_by_weight(const vector<tuple<int, int, W>> &edges)
+{
+    static_assert(is_integral_v<W>, "radix sort needs integral weights");
+    using U = make_unsigned_t<W>;
+    constexpr U flip = is_signed_v<W> ? U(1) << (8 * sizeof(W) - 1) : U(0);
+    int m = edges.size();
+    vector<U> key(m), key_tmp(m);
+    vector<int> idx(m), idx_tmp(m);
+    U all_or = 0, all_and = ~U(0);
+    for (int i = 0; i < m; i++) {
+        key[i] = U(get<2>(edges[i])) ^ flip; // signed -> unsigned order
+        idx[i] = i;
+        all_or |= key[i];
+        all_and &= key[i];
+    }
+    for (int shift = 0; shift < (int)(8 * sizeof(W)); shift += 8) {
+        if (((all_or ^ all_and) >> shift & 0xff) == 0) {
+            continue; // this byte is identical in every key
+        }
+        array<int, 257> cnt{};
+        for (int i = 0; i < m; i++) {
+            cnt[(key[i] >> shift & 0xff) + 1]++;
+        }
+        for (int d = 0; d < 256; d++) {
+            cnt[d + 1] += cnt[d];
+        }
+        for (int i = 0; i < m; i++) {
+            int p = cnt[key[i] >> shift & 0xff]++;
+            key_tmp[p] = key[i];
+            idx_tmp[p] = idx[i];
+        }
+        swap(key, key_tmp);
+        swap(idx, idx_tmp);
+    }
+    return idx;
+}
+
+// Kruskal's algorithm. O(E * sizeof(W) + E a(n)) time, O(n + E) space.
+template <typename W>
+MSTResult<W> kruskal(int n, const vector<tuple<int, int, W>> &edges, span<int> out = {})
+{
+    assert(out.empty() || (int)out.size() >= n - 1);
+    DSU dsu(n);
+    MSTResult<W> res{W{}, 0};
+    for (int e : sort_edges_by_weight(edges)) {
+        auto [u, v, w] = edges[e];
+        if (dsu.same(u, v)) {
+            continue;
+        }
+        dsu.merge(u, v);
+        res.weight += w;
+        if (!out.empty()) {
+            out[res.edges] = e;
+        }
+        if (++res.edges == n - 1) {
+            break;
+        }
+    }
+    return res;
+}
+
+// Parallel Boruvka. threads <= 0 means hardware_threads(). O((E / threads) log V)
+// time per thread, O(n + E) space.
+template <typename W>
+MSTResult<W> boruvka(int n,
+                     const vector<tuple<int, int, W>> &edges,
+                     int threads = 0,
+                     span<int> out = {})
+{
+    assert(out.empty() || (int)out.size() >= n - 1);
+    if (threads <= 0) {
+        threads = hardware_threads();
+    }
+    ConcurrentDSU dsu(n);
+    vector<atomic<int>> best(n); // cheapest edge leaving each root, -1 if none
+    for (auto &b : best) {
+        b.store(-1, memory_order_relaxed);
+    }
+    auto lighter = [&](int a, int b) {
+        W wa = get<2>(edges[a]), wb = get<2>(edges[b]);
+        return wa < wb || (wa == wb && a < b);
+    };
+    auto offer = [&](int r, int e) {
+        int cur = best[r].load(memory_order_relaxed);
+        while ((cur == -1 || lighter(e, cur)) &&
+               !best[r].compare_exchange_weak(cur, e, memory_order_relaxed)) {
+        }
+    };
+
+    vector<int> alive(edges.size());
+    iota(alive.begin(), alive.end(), 0);
+    vector<vector<int>> kept(threads);
+    vector<W> weight(threads, W{});
+    atomic<int> chosen = 0;
+    while (true) {
+        // 1. every live edge offers itself to both endpoint components; edges inside
+        //    one component are dropped for good
+        for (auto &k : kept) {
+            k.clear(); // parallel_for may use fewer threads than kept.size()
+        }
+        parallel_for(threads, alive.size(), [&](ll begin, ll end, int t) {
+            for (ll i = begin; i < end; i++) {
+                int e = alive[i];
+                int ru = dsu.find(get<0>(edges[e])), rv = dsu.find(get<1>(edges[e]));
+                if (ru == rv) {
+                    continue;
+                }
+                kept[t].push_back(e);
+                offer(ru, e);
+                offer(rv, e);
+            }
+        });
+        alive.clear();
+        for (auto &k : kept) {
+            alive.insert(alive.end(), k.begin(), k.end());
+        }
+        if (alive.empty()) {
+            break;
+        }
+        // 2. merge along every picked edge; an edge picked by both of its components
+        //    merges only once because the second merge() returns false
+        parallel_for(threads, n, [&](ll begin, ll end, int t) {
+            for (ll r = begin; r < end; r++) {
+                int e = best[r].load(memory_order_relaxed);
+                if (e == -1) {
+                    continue;
+                }
+                best[r].store(-1, memory_order_relaxed);
+                if (dsu.merge(get<0>(edges[e]), get<1>(edges[e]))) {
+                    weight[t] += get<2>(edges[e]);
+                    int slot = chosen++;
+                    if (!out.empty()) {
+                        out[slot] = e;
+                    }
+                }
+            }
+        });
+    }
+    MSTResult<W> res{W{}, chosen.load()};
+    for (W w : weight) {
+        res.weight += w;
+    }
+    return res;
+}
+} // namespace cp
@@ -0,0 +1,139 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include "cp/graph/csr_graph.hpp"
+
+namespace cp
+{
+// Strongly connected components (Tarjan) of a directed CSRGraph, iterative.
+//
+// The recursion is replaced by an explicit call stack of vertices plus a per-vertex
+// edge cursor, so a dependency chain of 1e7 vertices needs O(n) heap memory and no
+// call stack. comp[v] is the component id of v. Ids come out in reverse topological
+// order of the condensation: for every edge u -> v, comp[u] >= comp[v].
+//
+// Usage:
+//   SCC scc(g);
+//   scc.count;    // number of components
+//   scc.comp[v];  // 0 <= id < count
+//
+// Reference: https://cp-algorithms.com/graph/strongly-connected-components.html
+struct SCC
+{
+    int n;
+    int count = 0;
+    vector<int> comp;
+
+    // O(V + E) time, O(V) space.
+    SCC(const CSRGraph<> &g) : n(g.n), comp(n, -1)
+    {
+        vector<int> tin(n, -1), low(n), cursor(n), call, stack;
+        int timer = 0;
+        for (int s = 0; s < n; s++) {
+            if (tin[s] != -1) {
+                continue;
+            }
+            auto enter = [&](int v) {
+                tin[v] = low[v] = timer++;
+                cursor[v] = g.offsets[v];
+                call.push_back(v);
+                stack.push_back(v);
+            };
+            enter(s);
+            while (!call.empty()) {
+                int v = call.back();
+                if (cursor[v] < g.offsets[v + 1]) {
+                    int to = g.targets[cursor[v]++];
+                    if (tin[to] == -1) {
+                        enter(to);
+                    }
+                    else if (comp[to] == -1) {
+                        low[v] = min(low[v], tin[to]); // to is still on the stack
+                    }
+                    continue;
+                }
+                call.pop_back();
+                if (!call.empty()) {
+                    int p = call.back();
+                    low[p] = min(low[p], low[v]);
+                }
+                if (low[v] == tin[v]) {
+                    int w;
+                    do {
+                        w = stack.back();
+                        stack.pop_back();
+                        comp[w] = count;
+                    } while (w != v);
+                    count++;
+                }
+            }
+        }
+    }
+};
+
+// 2-SAT over n boolean variables, solved with SCC on the 2n-literal implication
+// graph. Literal (i, true) is vertex 2i and (i, false) is 2i + 1.
+//
+// The formula is satisfiable iff no variable shares a component with its negation.
+// Because SCC ids are reverse topological, choosing the literal with the smaller id
+// (the one later in topological order) for every variable gives a solution.
+//
+// Usage:
+//   TwoSat sat(n);
+//   sat.add_clause(a, true, b, false);     // a || !b
+//   sat.add_implication(a, true, b, true); // a -> b
+//   sat.set_value(c, false);               // !c
+//   if (sat.solve()) sat.value[i];
+//
+// Reference: https://cp-algorithms.com/graph/2SAT.html
+struct TwoSat
+{
+    int n;
+    vector<pair<int, int>> edges; // implication graph, built into a CSRGraph by solve
+    vector<char> value;
+
+    // O(1) time.
+    TwoSat(int vars) : n(vars) {}
+
+    // Adds (a == va) || (b == vb). O(1) amortized.
+    void add_clause(int a, bool va, int b, bool vb)
+    {
+        assert(a >= 0 && a < n && b >= 0 && b < n);
+        edges.push_back({literal(a, !va), literal(b, vb)});
+        edges.push_back({literal(b, !vb), literal(a, va)});
+    }
+
+    // Adds (a == va) -> (b == vb). O(1) amortized.
+    void add_implication(int a, bool va, int b, bool vb)
+    {
+        add_clause(a, !va, b, vb);
+    }
+
+    // Forces a == va. O(1) amortized.
+    void set_value(int a, bool va)
+    {
+        add_clause(a, va, a, va);
+    }
+
+    // Returns true if satisfiable and then fills value with a solution.
+    // O(n + clauses) time.
+    bool solve()
+    {
+        SCC scc(CSRGraph<>(2 * n, edges));
+        value.assign(n, 0);
+        for (int i = 0; i < n; i++) {
+            if (scc.comp[2 * i] == scc.comp[2 * i + 1]) {
+                value.clear();
+                return false;
+            }
+            value[i] = scc.comp[2 * i] < scc.comp[2 * i + 1];
+        }
+        return true;
+    }
+
+private:
+    static int literal(int i, bool v)
+    {
+        return 2 * i + !v;
+    }
+};
+} // namespace cp
@@ -0,0 +1,360 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Aho-Corasick automaton - matches many patterns against a text in one pass.
+//
+// All state lives in flat arrays indexed by state id; there are no per-node vectors or
+// maps. Two layouts are provided:
+//   AhoCorasick<K, first>   dense K-wide goto table, O(1) per character. Best for small
+//                           alphabets (K <= ~64), costs states * K ints.
+//   DoubleArrayAhoCorasick  double-array trie over the full byte alphabet plus failure
+//                           links, O(1) amortized per character, memory ~ O(states).
+//
+// Both share the same interface:
+//   int add(string_view p);            // returns the pattern id (0, 1, 2, ...)
+//   void build();                      // call once after all add() calls
+//   void feed(string_view chunk, F f); // f(pattern_id, end) for every match, where end
+//                                      // is the stream offset of the match's last char
+//   void reset();                      // rewinds the stream to offset 0
+//
+// feed() keeps the current state and stream offset between calls, so the text can be
+// delivered in arbitrary chunks (e.g. read() buffers) and matches spanning a chunk
+// boundary are still reported exactly once.
+//
+// Output links: every state stores the nearest state on its failure chain that ends a
+// pattern (dict_link), and each state lists its own patterns in an intrusive linked
+// list (pattern_head / pattern_next). Enumerating the matches at a position walks only
+// states that actually end a pattern, so feed() is O(chunk + matches).
+//
+// Reference: https://cp-algorithms.com/string/aho_corasick.html
+
+// Dense goto-table layout. Characters must lie in [first, first + K).
+template <int K = 26, char first = 'a'>
+struct AhoCorasick
+{
+    vector<int> next;         // next[s * K + c] - full goto function after build()
+    vector<int> fail;         // failure link (longest proper suffix that is a state)
+    vector<int> dict_link;    // nearest terminal state on the failure chain, -1 if none
+    vector<int> pattern_head; // first pattern ending at state, -1 if none
+    vector<int> pattern_next; // next pattern ending at the same state, -1 if none
+    vector<int> pattern_len;
+    int state = 0;
+    ll pos = 0; // number of characters fed since the last reset()
+
+    // O(1) time, O(K) space - creates the root state.
+    AhoCorasick()
+    {
+        new_state();
+    }
+
+    // O(|p|) time - inserts a non-empty pattern and returns its id. Must be called
+    // before build().
+    int add(string_view p)
+    {
+        assert(!p.empty());
+        int s = 0;
+        for (char ch : p) {
+            int c = index(ch);
+            if (next[s * K + c] == -1) {
+                int t = new_state();
+                next[s * K + c] = t;
+            }
+            s = next[s * K + c];
+        }
+        int id = pattern_len.size();
+        pattern_len.push_back(p.size());
+        pattern_next.push_back(pattern_head[s]);
+        pattern_head[s] = id;
+        return id;
+    }
+
+    // O(states * K) time - computes failure links, output links and fills missing
+    // transitions so that every step of feed() is a single table lookup.
+    void build()
+    {
+        int num = fail.size();
+        vector<int> queue;
+        queue.reserve(num);
+        fail[0] = 0;
+        for (int c = 0; c < K; c++) {
+            int t = next[c];
+            if (t == -1) {
+                next[c] = 0;
+            }
+            else {
+                fail[t] = 0;
+                queue.push_back(t);
+            }
+        }
+        // BFS order guarantees fail[s] (shallower) is finished before s is processed.
+        for (int head = 0; head < (int)queue.size(); head++) {
+            int s = queue[head];
+            int f = fail[s];
+            dict_link[s] = pattern_head[f] != -1 ? f : dict_link[f];
+            for (int c = 0; c < K; c++) {
+                int t = next[s * K + c];
+                if (t == -1) {
+                    next[s * K + c] = next[f * K + c];
+                }
+                else {
+                    fail[t] = next[f * K + c];
+                    queue.push_back(t);
+                }
+            }
+        }
+    }
+
+    // Rewinds the stream: the next feed() starts matching at offset 0.
+    void reset()
+    {
+        state = 0;
+        pos = 0;
+    }
+
+    // O(|chunk| + matches) time - advances the automaton over chunk and calls
+    // f(pattern_id, end) for each occurrence ending inside chunk.
+    template <typename F>
+    void feed(string_view chunk, F &&f)
+    {
+        int s = state;
+        for (char ch : chunk) {
+            s = next[s * K + index(ch)];
+            report(s, pos, f);
+            pos++;
+        }
+        state = s;
+    }
+
+private:
+    int new_state()
+    {
+        next.insert(next.end(), K, -1);
+        fail.push_back(0);
+        dict_link.push_back(-1);
+        pattern_head.push_back(-1);
+        return fail.size() - 1;
+    }
+
+    static int index(char ch)
+    {
+        int c = ch - first;
+        assert(c >= 0 && c < K);
+        return c;
+    }
+
+    template <typename F>
+    void report(int s, ll end, F &f) const
+    {
+        if (pattern_head[s] == -1) {
+            s = dict_link[s];
+        }
+        for (; s != -1; s = dict_link[s]) {
+            for (int id = pattern_head[s]; id != -1; id = pattern_next[id]) {
+                f(id, end);
+            }
+        }
+    }
+};
+
+// Double-array layout over bytes (alphabet of 256). The trie edge s --c--> t is stored
+// as t == base[s] + c with check[t] == s, so a transition is two array reads and the
+// arrays stay close to one slot per state even though the alphabet is large. Missing
+// transitions follow failure links at match time (amortized O(1) per character).
+struct DoubleArrayAhoCorasick
+{
+    static constexpr int K = 256;
+
+    vector<int> base;  // base[s] + c is the slot of s's child on byte c
+    vector<int> check; // check[t] == parent of t, -1 for free slots
+    vector<int> fail;
+    vector<int> dict_link;
+    vector<int> pattern_head;
+    vector<int> pattern_next;
+    vector<int> pattern_len;
+    int state = 0;
+    ll pos = 0;
+
+    // O(|p| * degree) time - inserts a pattern into a staging trie. Must be called
+    // before build().
+    int add(string_view p)
+    {
+        assert(!p.empty());
+        if (trie_label.empty()) {
+            trie_node(-1, 0);
+        }
+        int s = 0;
+        for (char ch : p) {
+            unsigned char c = ch;
+            int t = trie_first[s];
+            while (t != -1 && trie_label[t] != c) {
+                t = trie_sibling[t];
+            }
+            if (t == -1) {
+                t = trie_node(s, c);
+            }
+            s = t;
+        }
+        int id = pattern_len.size();
+        pattern_len.push_back(p.size());
+        pattern_next.push_back(trie_pattern[s]);
+        trie_pattern[s] = id;
+        return id;
+    }
+
+    // Lays the staging trie out as a double array, then computes failure and output
+    // links. Slot placement is first-fit starting from the lowest free slot, which
+    // keeps the arrays densely packed for typical pattern sets. The staging trie is
+    // released afterwards.
+    void build()
+    {
+        if (trie_label.empty()) {
+            trie_node(-1, 0);
+        }
+        int num = trie_label.size();
+        vector<int> slot(num, -1); // staging node -> double-array slot
+        vector<int> queue = {0};
+        queue.reserve(num);
+        slot[0] = 0;
+        grow(1);
+        check[0] = 0; // root is its own parent so slot 0 is never handed out
+        int free_from = 1;
+        vector<int> labels;
+        for (int head = 0; head < (int)queue.size(); head++) {
+            int u = queue[head];
+            int s = slot[u];
+            pattern_head[s] = trie_pattern[u];
+            labels.clear();
+            for (int t = trie_first[u]; t != -1; t = trie_sibling[t]) {
+                labels.push_back(trie_label[t]);
+            }
+            if (labels.empty()) {
+                continue;
+            }
+            sort(labels.begin(), labels.end());
+            while (free_from < (int)check.size() && check[free_from] != -1) {
+                free_from++;
+            }
+            int b = max(1, free_from - labels[0]);
+            while (!fits(b, labels)) {
+                b++;
+            }
+            base[s] = b;
+            grow(b + labels.back() + 1);
+            for (int c : labels) {
+                check[b + c] = s;
+            }
+            for (int t = trie_first[u]; t != -1; t = trie_sibling[t]) {
+                slot[t] = b + trie_label[t];
+                queue.push_back(t);
+            }
+        }
+
+        // Failure links in BFS order over the laid-out slots.
+        for (int i = 1; i < (int)queue.size(); i++) {
+            int u = queue[i];
+            int t = slot[u];
+            int p = slot[trie_parent[u]];
+            int c = trie_label[u];
+            int f = p == 0 ? -1 : fail[p];
+            while (f != -1 && child(f, c) == -1) {
+                f = f == 0 ? -1 : fail[f];
+            }
+            fail[t] = f == -1 ? 0 : child(f, c);
+            dict_link[t] =
+                pattern_head[fail[t]] != -1 ? fail[t] : dict_link[fail[t]];
+        }
+
+        trie_first = trie_sibling = trie_parent = trie_pattern = {};
+        trie_label = {};
+    }
+
+    // Rewinds the stream: the next feed() starts matching at offset 0.
+    void reset()
+    {
+        state = 0;
+        pos = 0;
+    }
+
+    // O(|chunk| + matches) amortized time - see AhoCorasick::feed.
+    template <typename F>
+    void feed(string_view chunk, F &&f)
+    {
+        int s = state;
+        for (char ch : chunk) {
+            unsigned char c = ch;
+            int t;
+            while ((t = child(s, c)) == -1 && s != 0) {
+                s = fail[s];
+            }
+            s = t == -1 ? 0 : t;
+            report(s, pos, f);
+            pos++;
+        }
+        state = s;
+    }
+
+    // Returns the slot of s's child on byte c, or -1.
+    int child(int s, int c) const
+    {
+        int t = base[s] + c;
+        return base[s] > 0 && t < (int)check.size() && check[t] == s ? t : -1;
+    }
+
+private:
+    // Staging trie: first-child / next-sibling lists, discarded by build().
+    vector<int> trie_first, trie_sibling, trie_parent, trie_pattern;
+    vector<unsigned char> trie_label;
+
+    int trie_node(int parent, unsigned char c)
+    {
+        int t = trie_label.size();
+        trie_first.push_back(-1);
+        trie_parent.push_back(parent);
+        trie_pattern.push_back(-1);
+        trie_label.push_back(c);
+        trie_sibling.push_back(-1);
+        if (parent != -1) {
+            trie_sibling[t] = trie_first[parent];
+            trie_first[parent] = t;
+        }
+        return t;
+    }
+
+    bool fits(int b, const vector<int> &labels) const
+    {
+        for (int c : labels) {
+            if (b + c < (int)check.size() && check[b + c] != -1) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void grow(int size)
+    {
+        if ((int)check.size() >= size) {
+            return;
+        }
+        base.resize(size, 0);
+        check.resize(size, -1);
+        fail.resize(size, 0);
+        dict_link.resize(size, -1);
+        pattern_head.resize(size, -1);
+    }
+
+    template <typename F>
+    void report(int s, ll end, F &f) const
+    {
+        if (pattern_head[s] == -1) {
+            s = dict_link[s];
+        }
+        for (; s != -1; s = dict_link[s]) {
+            for (int id = pattern_head[s]; id != -1; id = pattern_next[id]) {
+                f(id, end);
+            }
+        }
+    }
+};
+} // namespace cp
@@ -0,0 +1,212 @@
+#pragma once
+#include "cp/core/common.hpp"
+#include "cp/math/mod_int.hpp"
+
+namespace cp
+{
+// Polynomial rolling hash: hash(s[l..r)) = sum s[i] * base^(r - 1 - i).
+//
+// Two variants share the same interface:
+//   RollingHash                   modulus 2^61 - 1, one 64-bit value per hash.
+//   DoubleRollingHash<M1, M2>     two independent ModInt hashes packed into one
+//                                 64-bit value, for when a prime-field hash is needed.
+//
+//   RollingHash h(s);             // O(n) - prefix hashes and power table
+//   h.get(l, r);                  // O(1) - hash of s[l..r), half-open
+//   h.windows(len, out);          // O(n) - out[i] = get(i, i + len) for every window
+//                                 // start i, written into a caller buffer
+//
+// Hashes of equal strings compare equal across instances only if they share a base.
+// The default base is drawn once per process from a random source (anti-hack); pass
+// an explicit base to compare hashes between runs.
+//
+// Mod 2^61 - 1 arithmetic: for a product x < 2^122, x mod (2^61 - 1) equals
+// (x >> 61) + (x & (2^61 - 1)) up to one conditional subtraction, because 2^61 = 1.
+// No division or % is involved. The collision probability for two distinct strings of
+// length n is about n / 2^61.
+//
+// windows() computes every window independently from the prefix array (no loop-carried
+// dependency), so its iterations pipeline and the loop body is branch-free apart from
+// the final reduction's select.
+//
+// Reference: https://codeforces.com/blog/entry/60445
+struct Hash61
+{
+    static constexpr ull MOD = (1ULL << 61) - 1;
+
+    // Reduces x < 2^62 to [0, MOD).
+    static ull reduce(ull x)
+    {
+        x = (x & MOD) + (x >> 61);
+        return x >= MOD ? x - MOD : x;
+    }
+
+    static ull add(ull a, ull b)
+    {
+        return reduce(a + b);
+    }
+
+    // a - b for a, b in [0, MOD).
+    static ull sub(ull a, ull b)
+    {
+        return a >= b ? a - b : a + MOD - b;
+    }
+
+    static ull mul(ull a, ull b)
+    {
+        u128 x = (u128)a * b;
+        return reduce((ull)(x & MOD) + (ull)(x >> 61));
+    }
+
+    // Random base in [2^20, MOD - 2^20], fixed for the lifetime of the process.
+    static ull random_base()
+    {
+        static const ull base = [] {
+            mt19937_64 rng(chrono::steady_clock::now().time_since_epoch().count() ^
+                           random_device{}());
+            return uniform_int_distribution<ull>(1ULL << 20, MOD - (1ULL << 20))(rng);
+        }();
+        return base;
+    }
+};
+
+struct RollingHash
+{
+    ull base;
+    vector<ull> prefix; // prefix[i] = hash(s[0..i))
+    vector<ull> power;  // power[i] = base^i
+
+    // O(n) time, O(n) space.
+    RollingHash(string_view s, ull b = Hash61::random_base())
+        : base(b),
+          prefix(s.size() + 1),
+          power(s.size() + 1)
+    {
+        assert(b > 0 && b < Hash61::MOD);
+        power[0] = 1;
+        prefix[0] = 0;
+        for (size_t i = 0; i < s.size(); i++) {
+            power[i + 1] = Hash61::mul(power[i], base);
+            // + 1 keeps '\0' characters from hashing like the empty string
+            prefix[i + 1] = Hash61::add(Hash61::mul(prefix[i], base),
+                                        (unsigned char)s[i] + 1);
+        }
+    }
+
+    // Returns the hash of s[l..r). O(1) time.
+    ull get(int l, int r) const
+    {
+        assert(0 <= l && l <= r && r < (int)prefix.size());
+        return Hash61::sub(prefix[r], Hash61::mul(prefix[l], power[r - l]));
+    }
+
+    // Writes get(i, i + len) for every i in [0, n - len] into out. O(n) time, O(1)
+    // extra space. out must hold at least n - len + 1 values.
+    void windows(int len, ull *out) const
+    {
+        int n = prefix.size() - 1;
+        assert(len >= 0 && len <= n);
+        const ull pw = power[len];
+        const ull *pre = prefix.data();
+        for (int i = 0; i + len <= n; i++) {
+            out[i] = Hash61::sub(pre[i + len], Hash61::mul(pre[i], pw));
+        }
+    }
+
+    // Convenience overload returning a new vector.
+    vector<ull> windows(int len) const
+    {
+        vector<ull> out(prefix.size() - len);
+        windows(len, out.data());
+        return out;
+    }
+
+    // Hash of the concatenation a + b, given hash(b) and |b|. O(1) time. Requires
+    // len_b < power.size().
+    ull concat(ull hash_a, ull hash_b, int len_b) const
+    {
+        return Hash61::add(Hash61::mul(hash_a, power[len_b]), hash_b);
+    }
+};
+
+// Double hash over two ModInt fields. Each value packs the two residues as
+// (h1 << 32) | h2, so results compare, sort and hash like a single ull.
+template <int M1 = MOD, int M2 = 998244353>
+struct DoubleRollingHash
+{
+    using H1 = ModInt<M1>;
+    using H2 = ModInt<M2>;
+
+    H1 base1;
+    H2 base2;
+    vector<H1> prefix1, power1;
+    vector<H2> prefix2, power2;
+
+    // Random bases in [2, M1 - 2] and [2, M2 - 2], drawn independently once per process
+    // so all instances in one run agree.
+    static pair<ll, ll> random_bases()
+    {
+        static const pair<ll, ll> bases = [] {
+            mt19937_64 rng(chrono::steady_clock::now().time_since_epoch().count() ^
+                           random_device{}());
+            ll b1 = uniform_int_distribution<ll>(2, M1 - 2)(rng);
+            ll b2 = uniform_int_distribution<ll>(2, M2 - 2)(rng);
+            return pair{b1, b2};
+        }();
+        return bases;
+    }
+
+    // O(n) time, O(n) space.
+    DoubleRollingHash(string_view s,
+                      ll b1 = random_bases().first,
+                      ll b2 = random_bases().second)
+        : base1(b1),
+          base2(b2),
+          prefix1(s.size() + 1),
+          power1(s.size() + 1),
+          prefix2(s.size() + 1),
+          power2(s.size() + 1)
+    {
+        power1[0] = 1;
+        power2[0] = 1;
+        for (size_t i = 0; i < s.size(); i++) {
+            int c = (unsigned char)s[i] + 1;
+            power1[i + 1] = power1[i] * base1;
+            power2[i + 1] = power2[i] * base2;
+            prefix1[i + 1] = prefix1[i] * base1 + H1(c);
+            prefix2[i + 1] = prefix2[i] * base2 + H2(c);
+        }
+    }
+
+    // Returns the packed hash of s[l..r). O(1) time.
+    ull get(int l, int r) const
+    {
+        assert(0 <= l && l <= r && r < (int)prefix1.size());
+        H1 h1 = prefix1[r] - prefix1[l] * power1[r - l];
+        H2 h2 = prefix2[r] - prefix2[l] * power2[r - l];
+        return (ull)h1.val << 32 | (ull)h2.val;
+    }
+
+    // Writes get(i, i + len) for every i in [0, n - len] into out. O(n) time.
+    void windows(int len, ull *out) const
+    {
+        int n = prefix1.size() - 1;
+        assert(len >= 0 && len <= n);
+        const H1 pw1 = power1[len];
+        const H2 pw2 = power2[len];
+        for (int i = 0; i + len <= n; i++) {
+            H1 h1 = prefix1[i + len] - prefix1[i] * pw1;
+            H2 h2 = prefix2[i + len] - prefix2[i] * pw2;
+            out[i] = (ull)h1.val << 32 | (ull)h2.val;
+        }
+    }
+
+    // Convenience overload returning a new vector.
+    vector<ull> windows(int len) const
+    {
+        vector<ull> out(prefix1.size() - len);
+        windows(len, out.data());
+        return out;
+    }
+};
+} // namespace cp
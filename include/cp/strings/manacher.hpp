@@ -0,0 +1,74 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Manacher's algorithm - all maximal palindromes of a string in linear time.
+//
+// For every center i:
+//   odd[i]  = number of odd-length palindromes centered at i; the longest one is
+//             s[i - odd[i] + 1 .. i + odd[i] - 1], of length 2 * odd[i] - 1.
+//   even[i] = number of even-length palindromes centered between i - 1 and i; the
+//             longest one is s[i - even[i] .. i + even[i] - 1], of length 2 * even[i].
+//
+// The kernel writes into caller-provided buffers of at least |s| ints each and
+// allocates nothing.
+//
+// Reference: https://cp-algorithms.com/string/manacher.html
+
+// O(n) time, O(1) extra space.
+inline void manacher(string_view s, int *odd, int *even)
+{
+    int n = s.size();
+    // [l, r] is the rightmost palindrome found so far
+    for (int i = 0, l = 0, r = -1; i < n; i++) {
+        int k = i > r ? 1 : min(odd[l + r - i], r - i + 1);
+        while (i - k >= 0 && i + k < n && s[i - k] == s[i + k]) {
+            k++;
+        }
+        odd[i] = k;
+        if (i + k - 1 > r) {
+            l = i - k + 1;
+            r = i + k - 1;
+        }
+    }
+    for (int i = 0, l = 0, r = -1; i < n; i++) {
+        int k = i > r ? 0 : min(even[l + r - i + 1], r - i + 1);
+        while (i - k - 1 >= 0 && i + k < n && s[i - k - 1] == s[i + k]) {
+            k++;
+        }
+        even[i] = k;
+        if (i + k - 1 > r) {
+            l = i - k;
+            r = i + k - 1;
+        }
+    }
+}
+
+// O(n) time, O(n) space - returns {odd, even}.
+inline pair<vector<int>, vector<int>> manacher(string_view s)
+{
+    vector<int> odd(s.size()), even(s.size());
+    manacher(s, odd.data(), even.data());
+    return {odd, even};
+}
+
+// Returns {start, length} of the leftmost longest palindromic substring. O(n) time,
+// O(n) space.
+inline pair<int, int> longest_palindrome(string_view s)
+{
+    auto [odd, even] = manacher(s);
+    int best_start = 0, best_len = 0;
+    for (int i = 0; i < (int)s.size(); i++) {
+        if (2 * odd[i] - 1 > best_len) {
+            best_len = 2 * odd[i] - 1;
+            best_start = i - odd[i] + 1;
+        }
+        if (2 * even[i] > best_len) {
+            best_len = 2 * even[i];
+            best_start = i - even[i];
+        }
+    }
+    return {best_start, best_len};
+}
+} // namespace cp
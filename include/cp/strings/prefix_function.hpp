@@ -0,0 +1,99 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Prefix function (KMP failure function): pi[i] = length of the longest proper prefix
+// of s[0..i] that is also a suffix of it.
+//
+// prefix_function writes into a caller-provided buffer and allocates nothing, so one
+// buffer can be reused across many calls.
+//
+// KmpMatcher finds occurrences of a fixed pattern in a stream delivered in chunks. It
+// keeps the matched length and stream offset between feed() calls, so matches that
+// span chunk boundaries are reported exactly once and the text is never buffered.
+//
+// Usage:
+//   KmpMatcher m("abab");
+//   m.feed(chunk1, [&](ll end) { ... }); // end = stream offset of the last char
+//   m.feed(chunk2, [&](ll end) { ... }); // matches across the boundary are found
+//
+// Reference: https://cp-algorithms.com/string/prefix-function.html
+
+// O(n) time, O(1) extra space - writes pi into out[0..n).
+inline void prefix_function(string_view s, int *out)
+{
+    int n = s.size();
+    if (n == 0) {
+        return;
+    }
+    out[0] = 0;
+    for (int i = 1; i < n; i++) {
+        int k = out[i - 1];
+        while (k > 0 && s[i] != s[k]) {
+            k = out[k - 1];
+        }
+        out[i] = k + (s[i] == s[k]);
+    }
+}
+
+// O(n) time, O(n) space.
+inline vector<int> prefix_function(string_view s)
+{
+    vector<int> pi(s.size());
+    prefix_function(s, pi.data());
+    return pi;
+}
+
+struct KmpMatcher
+{
+    string pattern;
+    vector<int> pi;
+    int matched = 0; // length of the pattern prefix matching the end of the stream
+    ll pos = 0;      // number of characters fed since the last reset()
+
+    // O(|p|) time, O(|p|) space. p must be non-empty.
+    KmpMatcher(string_view p) : pattern(p), pi(p.size())
+    {
+        assert(!p.empty());
+        prefix_function(pattern, pi.data());
+    }
+
+    // Rewinds the stream: the next feed() starts matching at offset 0.
+    void reset()
+    {
+        matched = 0;
+        pos = 0;
+    }
+
+    // O(|chunk|) amortized time - calls f(end) for each occurrence ending inside chunk.
+    template <typename F>
+    void feed(string_view chunk, F &&f)
+    {
+        int m = pattern.size();
+        int k = matched;
+        for (char ch : chunk) {
+            while (k > 0 && ch != pattern[k]) {
+                k = pi[k - 1];
+            }
+            if (ch == pattern[k]) {
+                k++;
+            }
+            if (k == m) {
+                f(pos);
+                k = pi[k - 1];
+            }
+            pos++;
+        }
+        matched = k;
+    }
+
+    // Returns the number of occurrences ending inside chunk; state carries over.
+    ll count(string_view chunk)
+    {
+        ll cnt = 0;
+        feed(chunk, [&](ll) { cnt++; });
+        return cnt;
+    }
+};
+} // namespace cp
@@ -0,0 +1,309 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Suffix automaton (SAM) - the minimal DFA accepting all suffixes of a string. It has
+// at most 2n - 1 states and 3n - 4 transitions, and every substring of s corresponds to
+// a path from the root.
+//
+// States live in flat per-state arrays (an arena indexed by state id); there is no
+// per-state container. Transitions use adaptive storage:
+//   - degree <= S: an inline array of S (symbol, target) pairs in small_key /
+//     small_next, in insertion order and searched by a linear scan over at most S
+//     entries. Most states of real inputs land here (average out-degree is < 2).
+//   - degree > S: the state is promoted to a dense K-wide block in the dense pool, and
+//     small_next[s * S] stores the block index.
+// With S = 4 a state costs ~30 bytes plus its share of the dense pool, versus ~50 bytes
+// per transition plus the map header for map<char, int>.
+//
+// Characters must lie in [first, first + K), K <= 256. SuffixAutomaton<256, CHAR_MIN>
+// accepts arbitrary bytes.
+//
+// Usage:
+//   SuffixAutomaton<> sam("abcbc");
+//   sam.count_distinct();           // number of distinct non-empty substrings
+//   sam.compute_occurrences();      // once, after the string is complete
+//   sam.occurrences("bc");          // occurrences of a pattern in s
+//   auto [l, i] = sam.lcs("xbcbq"); // longest common substring: length, start in t
+//
+// Reference: https://cp-algorithms.com/string/suffix-automaton.html
+template <int K = 26, char first = 'a'>
+struct SuffixAutomaton
+{
+    static_assert(K > 0 && K <= 256);
+    static constexpr int S = 4; // inline capacity before promotion to a dense block
+
+    vector<int> len;           // length of the longest string in the state
+    vector<int> link;          // suffix link, -1 for the root
+    vector<uint16_t> deg;      // number of outgoing transitions
+    vector<uint8_t> small_key; // S symbols per state, unsorted
+    vector<int> small_next;    // S targets per state, or the dense block index
+    vector<int> dense;         // K targets per promoted state, -1 if absent
+    vector<char> is_clone;     // clones do not end a prefix of s
+    vector<int> occ;           // filled by compute_occurrences()
+    int last = 0;
+
+    // O(1) time - empty automaton.
+    SuffixAutomaton()
+    {
+        new_state(0, -1);
+    }
+
+    // O(n) time, O(n) space - reserves the 2n state arena up front.
+    SuffixAutomaton(string_view s)
+    {
+        reserve(s.size());
+        new_state(0, -1);
+        for (char ch : s) {
+            extend(ch);
+        }
+    }
+
+    // Preallocates room for a string of n characters.
+    void reserve(size_t n)
+    {
+        size_t states = 2 * n + 1;
+        len.reserve(states);
+        link.reserve(states);
+        deg.reserve(states);
+        small_key.reserve(states * S);
+        small_next.reserve(states * S);
+        is_clone.reserve(states);
+    }
+
+    int size() const
+    {
+        return len.size();
+    }
+
+    // Appends one character. O(1) amortized time.
+    void extend(char ch)
+    {
+        int c = index(ch);
+        int cur = new_state(len[last] + 1, -1);
+        int p = last;
+        while (p != -1 && go(p, c) == -1) {
+            set(p, c, cur);
+            p = link[p];
+        }
+        if (p == -1) {
+            link[cur] = 0;
+        }
+        else {
+            int q = go(p, c);
+            if (len[p] + 1 == len[q]) {
+                link[cur] = q;
+            }
+            else {
+                int clone = clone_state(q, len[p] + 1);
+                while (p != -1 && go(p, c) == q) {
+                    set(p, c, clone);
+                    p = link[p];
+                }
+                link[q] = link[cur] = clone;
+            }
+        }
+        last = cur;
+        occ.clear();
+    }
+
+    // Returns the target of state s on symbol index c (0-based), or -1. O(S) time: an
+    // unsorted linear scan of the deg[s] <= S inline keys, or one dense block read.
+    int go(int s, int c) const
+    {
+        if (deg[s] > S) {
+            return dense[(size_t)small_next[(size_t)s * S] * K + c];
+        }
+        const uint8_t *key = &small_key[(size_t)s * S];
+        for (int i = 0; i < deg[s]; i++) {
+            if (key[i] == c) {
+                return small_next[(size_t)s * S + i];
+            }
+        }
+        return -1;
+    }
+
+    // Number of distinct non-empty substrings. O(states) time.
+    ll count_distinct() const
+    {
+        ll res = 0;
+        for (int v = 1; v < size(); v++) {
+            res += len[v] - len[link[v]];
+        }
+        return res;
+    }
+
+    // Returns states sorted by len ascending (a topological order of suffix links
+    // reversed). O(states) time via counting sort.
+    vector<int> order_by_len() const
+    {
+        int n = len[last];
+        vector<int> cnt(n + 2, 0);
+        for (int v = 0; v < size(); v++) {
+            cnt[len[v] + 1]++;
+        }
+        for (int i = 1; i <= n + 1; i++) {
+            cnt[i] += cnt[i - 1];
+        }
+        vector<int> order(size());
+        for (int v = 0; v < size(); v++) {
+            order[cnt[len[v]]++] = v;
+        }
+        return order;
+    }
+
+    // Computes occ[v] = number of occurrences in s of each string in state v, by
+    // propagating counts along suffix links in decreasing len order. O(states) time.
+    void compute_occurrences()
+    {
+        occ.assign(size(), 0);
+        for (int v = 1; v < size(); v++) {
+            occ[v] = !is_clone[v];
+        }
+        vector<int> order = order_by_len();
+        for (int i = size() - 1; i > 0; i--) {
+            int v = order[i];
+            occ[link[v]] += occ[v];
+        }
+    }
+
+    // Returns the state reached by reading p from the root, or -1. O(|p| * S) time.
+    int find(string_view p) const
+    {
+        int s = 0;
+        for (char ch : p) {
+            s = go(s, index(ch));
+            if (s == -1) {
+                return -1;
+            }
+        }
+        return s;
+    }
+
+    bool contains(string_view p) const
+    {
+        return find(p) != -1;
+    }
+
+    // Number of occurrences of non-empty p in s. compute_occurrences() must have been
+    // called after the last extend(). O(|p| * S) time.
+    int occurrences(string_view p) const
+    {
+        assert(!p.empty() && (int)occ.size() == size());
+        int s = find(p);
+        return s == -1 ? 0 : occ[s];
+    }
+
+    // Longest common substring of s and t as {length, start index in t}. Characters of
+    // t outside the alphabet break the match. O(|t| * S) amortized time.
+    pair<int, int> lcs(string_view t) const
+    {
+        int v = 0, l = 0, best = 0, best_end = 0;
+        for (int i = 0; i < (int)t.size(); i++) {
+            int c = t[i] - first;
+            if (c < 0 || c >= K) {
+                v = 0;
+                l = 0;
+                continue;
+            }
+            while (v != 0 && go(v, c) == -1) {
+                v = link[v];
+                l = len[v];
+            }
+            int nv = go(v, c);
+            if (nv != -1) {
+                v = nv;
+                l++;
+            }
+            if (l > best) {
+                best = l;
+                best_end = i + 1;
+            }
+        }
+        return {best, best_end - best};
+    }
+
+private:
+    static int index(char ch)
+    {
+        int c = ch - first;
+        assert(c >= 0 && c < K);
+        return c;
+    }
+
+    int new_state(int length, int suffix_link)
+    {
+        len.push_back(length);
+        link.push_back(suffix_link);
+        deg.push_back(0);
+        small_key.insert(small_key.end(), S, 0);
+        small_next.insert(small_next.end(), S, -1);
+        is_clone.push_back(0);
+        return len.size() - 1;
+    }
+
+    int clone_state(int q, int length)
+    {
+        int v = new_state(length, link[q]);
+        is_clone[v] = 1;
+        deg[v] = deg[q];
+        copy_n(&small_key[(size_t)q * S], S, &small_key[(size_t)v * S]);
+        copy_n(&small_next[(size_t)q * S], S, &small_next[(size_t)v * S]);
+        if (deg[q] > S) {
+            int block = new_dense_block();
+            size_t from = (size_t)small_next[(size_t)q * S] * K;
+            copy_n(dense.begin() + from, K, dense.begin() + (size_t)block * K);
+            small_next[(size_t)v * S] = block;
+        }
+        return v;
+    }
+
+    int new_dense_block()
+    {
+        dense.insert(dense.end(), K, -1);
+        return dense.size() / K - 1;
+    }
+
+    // Sets (or overwrites) the transition s --c--> t, promoting s to a dense block
+    // when its small array overflows.
+    void set(int s, int c, int t)
+    {
+        size_t off = (size_t)s * S;
+        if (deg[s] > S) {
+            int &slot = dense[(size_t)small_next[off] * K + c];
+            deg[s] += slot == -1;
+            slot = t;
+            return;
+        }
+        uint8_t *key = &small_key[off];
+        int *nxt = &small_next[off];
+        int d = deg[s];
+        int i = 0;
+        while (i < d && key[i] < c) {
+            i++;
+        }
+        if (i < d && key[i] == c) {
+            nxt[i] = t;
+            return;
+        }
+        if (d < S) {
+            for (int j = d; j > i; j--) {
+                key[j] = key[j - 1];
+                nxt[j] = nxt[j - 1];
+            }
+            key[i] = c;
+            nxt[i] = t;
+            deg[s]++;
+            return;
+        }
+        int block = new_dense_block();
+        for (int j = 0; j < d; j++) {
+            dense[(size_t)block * K + key[j]] = nxt[j];
+        }
+        dense[(size_t)block * K + c] = t;
+        nxt[0] = block;
+        deg[s]++;
+    }
+};
+} // namespace cp
@@ -0,0 +1,47 @@
+#pragma once
+#include "cp/core/common.hpp"
+
+namespace cp
+{
+// Z-function: z[i] = length of the longest common prefix of s and s[i..]. z[0] = n by
+// convention.
+//
+// The kernel writes into a caller-provided buffer of at least |s| ints and allocates
+// nothing, so it can be called in a loop over many short strings with one reusable
+// buffer. The vector overload is a convenience wrapper.
+//
+// Pattern matching: occurrences of p in t are the i with z[|p| + 1 + i] >= |p| for the
+// string p + sep + t, where sep occurs in neither.
+//
+// Reference: https://cp-algorithms.com/string/z-function.html
+
+// O(n) time, O(1) extra space - writes z into out[0..n).
+inline void z_function(string_view s, int *out)
+{
+    int n = s.size();
+    if (n == 0) {
+        return;
+    }
+    out[0] = n;
+    // [l, r) is the rightmost segment known to match a prefix of s
+    for (int i = 1, l = 0, r = 0; i < n; i++) {
+        int z = i < r ? min(r - i, out[i - l]) : 0;
+        while (i + z < n && s[z] == s[i + z]) {
+            z++;
+        }
+        if (i + z > r) {
+            l = i;
+            r = i + z;
+        }
+        out[i] = z;
+    }
+}
+
+// O(n) time, O(n) space.
+inline vector<int> z_function(string_view s)
+{
+    vector<int> z(s.size());
+    z_function(s, z.data());
+    return z;
+}
+} // namespace cp
@@ -5,6 +5,8 @@ TEST_CASE(typedefs_are_correct_sizes)
 {
     EXPECT_EQ(sizeof(cp::ll), 8u);
     EXPECT_EQ(sizeof(cp::ull), 8u);
+    EXPECT_EQ(sizeof(cp::i128), 16u);
+    EXPECT_EQ(sizeof(cp::u128), 16u);
 }
 
 TEST_CASE(inf_constants_are_positive)
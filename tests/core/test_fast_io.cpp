@@ -0,0 +1,182 @@
+#include "../framework/test_framework.hpp"
+#include "cp/core/fast_io.hpp"
+#include "cp/math/mod_int.hpp"
+
+// An unlinked temporary file holding text, positioned at its start.
+static int file_with(const std::string &text)
+{
+    FILE *f = tmpfile();
+    int fd = dup(fileno(f));
+    fclose(f);
+    EXPECT_EQ(write(fd, text.data(), text.size()), (ssize_t)text.size());
+    lseek(fd, 0, SEEK_SET);
+    return fd;
+}
+
+static std::string read_all(int fd)
+{
+    lseek(fd, 0, SEEK_SET);
+    std::string s;
+    char buf[4096];
+    for (ssize_t got; (got = read(fd, buf, sizeof(buf))) > 0;) {
+        s.append(buf, got);
+    }
+    return s;
+}
+
+static std::string random_ints_text(std::mt19937_64 &rng,
+                                    int n,
+                                    std::vector<cp::ll> &vals)
+{
+    std::string text;
+    const char *seps[] = {" ", "\n", "\t", "  ", "\r\n"};
+    for (int i = 0; i < n; i++) {
+        cp::ll v = rng() % 4 == 0 ? (cp::ll)rng() : (cp::ll)(rng() % 2001) - 1000;
+        vals.push_back(v);
+        text += std::to_string(v) + seps[rng() % 5];
+    }
+    return text;
+}
+
+TEST_CASE(fast_io_reads_types_from_file)
+{
+    int fd = file_with("3\n-7 +8 9223372036854775807 -9223372036854775808\n"
+                       "1000000008 word c -170141183460469231731687303715884105728 "
+                       "18446744073709551615 007");
+    cp::FastInput in(fd);
+    auto v = in.read_vector<cp::ll>(in.read<int>());
+    EXPECT_TRUE((v == std::vector<cp::ll>{-7, 8, std::numeric_limits<cp::ll>::max()}));
+    EXPECT_EQ(in.read<cp::ll>(), std::numeric_limits<cp::ll>::min());
+    cp::mint m;
+    std::string s;
+    char c;
+    cp::i128 big;
+    unsigned long long u;
+    in.read(m, s, c, big, u);
+    EXPECT_EQ(m.val, 1);
+    EXPECT_EQ(s, std::string("word"));
+    EXPECT_EQ(c, 'c');
+    EXPECT_TRUE(big == -((cp::i128)1 << 126) * 2);
+    EXPECT_EQ(u, std::numeric_limits<unsigned long long>::max());
+    EXPECT_EQ(in.read<int>(), 7);
+    EXPECT_FALSE(in.has_next());
+    EXPECT_EQ(in.read<int>(), 0); // past the end
+    close(fd);
+}
+
+// Sizes at and just below a page boundary take the read() path (no 8-byte zero tail);
+// the others are mapped. Both must parse every digit count the same way.
+TEST_CASE(fast_io_matches_to_string_on_mapped_and_buffered_files)
+{
+    std::mt19937_64 rng(48);
+    long page = sysconf(_SC_PAGESIZE);
+    for (long size : {page - 20, page - 5, page, 3 * page + 1, 50 * page + 7}) {
+        std::vector<cp::ll> vals;
+        std::string text;
+        while ((long)text.size() < size) {
+            text += random_ints_text(rng, 1, vals);
+        }
+        text.resize(size); // may cut the last number short; the oracle sees the same
+        if (text.back() == '-') {
+            text.back() = ' ';
+        }
+        std::istringstream expect_in(text);
+        std::vector<cp::ll> expect;
+        for (cp::ll x; expect_in >> x;) {
+            expect.push_back(x);
+        }
+        int fd = file_with(text);
+        cp::FastInput in(fd);
+        std::vector<cp::ll> got;
+        while (in.has_next()) {
+            got.push_back(in.read<cp::ll>());
+        }
+        EXPECT_TRUE(got == expect);
+        close(fd);
+    }
+}
+
+// A pipe hands over data in arbitrary pieces, including tokens cut in half.
+TEST_CASE(fast_io_reads_pipe_in_pieces)
+{
+    std::mt19937_64 rng(49);
+    std::vector<cp::ll> vals;
+    std::string text = random_ints_text(rng, 200000, vals);
+    int fds[2];
+    EXPECT_EQ(pipe(fds), 0);
+    std::thread writer([&] {
+        for (size_t off = 0; off < text.size();) {
+            size_t k = std::min<size_t>(text.size() - off, 1 + rng() % 100000);
+            if (rng() % 8 == 0) {
+                k = std::min<size_t>(k, 3); // tiny pieces split numbers
+            }
+            off += write(fds[1], text.data() + off, k);
+        }
+        close(fds[1]);
+    });
+    cp::FastInput in(fds[0]);
+    std::vector<cp::ll> got = in.read_vector<cp::ll>(vals.size());
+    writer.join();
+    EXPECT_FALSE(in.has_next());
+    EXPECT_TRUE(got == vals);
+    close(fds[0]);
+}
+
+// A token that is not a number reads as 0 and is consumed, so a has_next() loop ends.
+// The long junk token makes the pipe reader refill while skipping it.
+TEST_CASE(fast_io_skips_non_numeric_tokens)
+{
+    std::string text = "abc 5 x-1 - " + std::string(100000, 'z') + " 7\n";
+    std::vector<int> want = {0, 5, 0, 0, 0, 7};
+    int fd = file_with(text);
+    int fds[2];
+    EXPECT_EQ(pipe(fds), 0);
+    std::thread writer([&] {
+        for (size_t off = 0; off < text.size();) {
+            off += write(fds[1], text.data() + off, text.size() - off);
+        }
+        close(fds[1]);
+    });
+    for (int src : {fd, fds[0]}) {
+        cp::FastInput in(src);
+        std::vector<int> got;
+        while (in.has_next()) {
+            got.push_back(in.read<int>());
+        }
+        EXPECT_TRUE(got == want);
+    }
+    writer.join();
+    close(fd);
+    close(fds[0]);
+}
+
+TEST_CASE(fast_io_writes_integers_mod_ints_and_text)
+{
+    std::mt19937_64 rng(50);
+    FILE *f = tmpfile();
+    int fd = fileno(f);
+    std::string expect;
+    {
+        cp::FastOutput out(fd);
+        for (int i = 0; i < 100000; i++) { // several buffer flushes
+            cp::ll v = (cp::ll)rng() >> (rng() % 64);
+            out << v << ' ';
+            expect += std::to_string(v) + " ";
+        }
+        out.println(cp::mint(-1), std::numeric_limits<cp::ll>::min(), 0, 'x', "str");
+        expect += std::to_string(cp::MOD - 1) + " -9223372036854775808 0 x str\n";
+        out.write((cp::i128)((cp::u128)1 << 127));
+        out.write(' ');
+        out.write(~(cp::u128)0);
+        out.write('\n');
+        expect += "-170141183460469231731687303715884105728 "
+                  "340282366920938463463374607431768211455\n";
+        out.write_vector(std::vector<int>{1, 22, 333}, ',');
+        expect += "1,22,333\n";
+        std::string longer(200000, 'z'); // longer than the buffer
+        out.write(longer);
+        expect += longer;
+    }
+    EXPECT_TRUE(read_all(fd) == expect);
+    fclose(f);
+}
@@ -0,0 +1,35 @@
+#include "../framework/test_framework.hpp"
+#include "cp/core/parallel.hpp"
+
+TEST_CASE(parallel_for_covers_range_once)
+{
+    for (int threads : {1, 2, 3, 8}) {
+        std::vector<int> hits(1000, 0);
+        cp::parallel_for(threads, 1000, [&](cp::ll begin, cp::ll end, int) {
+            for (cp::ll i = begin; i < end; i++) {
+                hits[i]++;
+            }
+        });
+        EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), 1000);
+    }
+}
+
+TEST_CASE(parallel_for_thread_ids_are_distinct)
+{
+    std::vector<int> seen(4, 0);
+    cp::parallel_for(4, 100, [&](cp::ll, cp::ll, int t) { seen[t]++; });
+    EXPECT_EQ(seen, (std::vector<int>{1, 1, 1, 1}));
+}
+
+TEST_CASE(parallel_for_small_and_empty_ranges)
+{
+    // EXPECT_* throws, so checks run on the main thread after the join
+    std::vector<cp::ll> sizes(8, -1);
+    auto record = [&](cp::ll begin, cp::ll end, int t) { sizes[t] = end - begin; };
+    cp::parallel_for(8, 3, record);
+    EXPECT_EQ(sizes, (std::vector<cp::ll>{1, 1, 1, -1, -1, -1, -1, -1}));
+    sizes.assign(8, -1);
+    cp::parallel_for(8, 0, record);
+    EXPECT_EQ(sizes, (std::vector<cp::ll>{0, -1, -1, -1, -1, -1, -1, -1}));
+    EXPECT_TRUE(cp::hardware_threads() >= 1);
+}
@@ -0,0 +1,104 @@
+#include "../framework/test_framework.hpp"
+#include "cp/ds/dsu.hpp"
+#include "cp/ds/dyn_seg_tree.hpp"
+#include "cp/ds/fenwick.hpp"
+#include "cp/ds/range_seg_tree.hpp"
+#include "cp/ds/seg_tree.hpp"
+#include "cp/ds/sum_add_range_seg_tree.hpp"
+
+// Run by make test (counters off) and make test STATS=1 (counters on); each case checks
+// whichever applies.
+
+TEST_CASE(stats_off_is_free)
+{
+    if constexpr (!cp::stats_enabled) {
+        struct DsuLayout
+        {
+            int n;
+            std::vector<int> parents, sizes;
+        };
+        struct FenwickLayout
+        {
+            int n;
+            std::vector<cp::ll> tree;
+        };
+        EXPECT_EQ(sizeof(cp::DSU), sizeof(DsuLayout));
+        EXPECT_EQ(sizeof(cp::Fenwick<cp::ll>), sizeof(FenwickLayout));
+        cp::DSU d(4);
+        d.merge(0, 1);
+        EXPECT_EQ(d.stats().finds, 0);
+        int fields = 0;
+        d.stats().each([&](const char *, cp::ll) { fields++; });
+        EXPECT_EQ(fields, 0);
+    }
+}
+
+TEST_CASE(stats_dsu_counts_finds_and_path_steps)
+{
+    cp::DSU d(4);
+    d.merge(0, 1); // 1 under 0
+    d.merge(2, 3); // 3 under 2
+    d.merge(0, 2); // 2 under 0: 3 -> 2 -> 0
+    d.reset_stats();
+    EXPECT_EQ(d.find(3), 0);
+    EXPECT_EQ(d.find(3), 0); // compressed by the first find
+    if constexpr (cp::stats_enabled) {
+        EXPECT_EQ(d.stats().finds, 2);
+        EXPECT_EQ(d.stats().path_steps, 3);
+    }
+}
+
+TEST_CASE(stats_range_seg_tree_counts_lazy_pushdowns)
+{
+    cp::RangeSegTree<cp::LongSumAddPolicy> st(8);
+    st.update(0, 7, 5); // whole range: root only, no push_down
+    if constexpr (cp::stats_enabled) {
+        EXPECT_EQ(st.stats().node_visits, 1);
+        EXPECT_EQ(st.stats().pushdowns, 0);
+    }
+    EXPECT_EQ(st.query(0, 0), 5); // root -> leaf: 3 push_downs, each carrying a lazy
+    if constexpr (cp::stats_enabled) {
+        EXPECT_EQ(st.stats().pushdowns, 3);
+        EXPECT_EQ(st.stats().lazy_pushdowns, 3);
+    }
+    st.reset_stats();
+    EXPECT_EQ(st.query(0, 0), 5); // same path, lazies already pushed
+    if constexpr (cp::stats_enabled) {
+        EXPECT_EQ(st.stats().pushdowns, 3);
+        EXPECT_EQ(st.stats().lazy_pushdowns, 0);
+    }
+    cp::SumAddRangeSegTree<cp::ll> sa(8);
+    sa.update(0, 7, 5);
+    EXPECT_EQ(sa.query(0, 0), 5);
+    if constexpr (cp::stats_enabled) {
+        EXPECT_EQ(sa.stats().lazy_pushdowns, 3);
+    }
+}
+
+TEST_CASE(stats_dyn_seg_tree_counts_allocations)
+{
+    cp::LongDynSegTree st(1 << 20);
+    st.update(0, 0, 1); // leftmost leaf: two children allocated per level
+    if constexpr (cp::stats_enabled) {
+        EXPECT_EQ(st.stats().allocations, 1 + 2 * 20);
+    }
+    st.reset_stats();
+    EXPECT_EQ(st.query(0, (1 << 20) - 1), 1);
+    if constexpr (cp::stats_enabled) {
+        EXPECT_EQ(st.stats().node_visits, 1);
+        EXPECT_EQ(st.stats().allocations, 0);
+    }
+}
+
+TEST_CASE(stats_seg_tree_and_fenwick_count_visits)
+{
+    cp::SegTree<cp::ll, std::plus<cp::ll>{}> st(8);
+    st.update(5, 1); // root to leaf: 4 nodes
+    cp::Fenwick<cp::ll> fw(8);
+    fw.add(0, 1); // cells 0, 1, 3, 7
+    EXPECT_EQ(fw.query(6), 1); // cells 6, 5, 3
+    if constexpr (cp::stats_enabled) {
+        EXPECT_EQ(st.stats().node_visits, 4);
+        EXPECT_EQ(fw.stats().node_visits, 7);
+    }
+}
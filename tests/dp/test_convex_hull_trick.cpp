@@ -0,0 +1,82 @@
+#include "../framework/test_framework.hpp"
+#include "cp/dp/convex_hull_trick.hpp"
+
+TEST_CASE(monotone_cht_matches_brute_force)
+{
+    std::mt19937 rng(40);
+    for (int it = 0; it < 300; it++) {
+        int n = 1 + rng() % 30;
+        std::vector<std::pair<cp::ll, cp::ll>> lines;
+        for (int i = 0; i < n; i++) {
+            lines.push_back({(cp::ll)(rng() % 41) - 20, (cp::ll)(rng() % 2001) - 1000});
+        }
+        std::sort(lines.rbegin(), lines.rend()); // non-increasing slopes, some equal
+        cp::MonotoneCHT<cp::ll> cht;
+        for (auto [k, b] : lines) {
+            cht.add_line(k, b);
+        }
+        std::vector<cp::ll> xs;
+        for (int q = 0; q < 40; q++) {
+            xs.push_back((cp::ll)(rng() % 201) - 100);
+        }
+        std::sort(xs.begin(), xs.end());
+        for (cp::ll x : xs) {
+            cp::ll want = LLONG_MAX;
+            for (auto [k, b] : lines) {
+                want = std::min(want, k * x + b);
+            }
+            EXPECT_EQ(cht.query(x), want);
+            EXPECT_EQ(cht.query_monotone(x), want);
+        }
+    }
+}
+
+TEST_CASE(monotone_cht_interleaved_dp)
+{
+    // dp[i] = min over j < i of dp[j] + (x[i] - x[j])^2 + C, x increasing: slope
+    // -2 x[j] decreasing, query points x[i] increasing
+    std::mt19937 rng(41);
+    int n = 2000;
+    cp::ll C = 1000;
+    std::vector<cp::ll> x(n), dp(n), naive(n);
+    for (int i = 1; i < n; i++) {
+        x[i] = x[i - 1] + 1 + rng() % 50;
+    }
+    cp::MonotoneCHT<cp::ll> cht;
+    cht.add_line(-2 * x[0], dp[0] + x[0] * x[0]);
+    for (int i = 1; i < n; i++) {
+        dp[i] = cht.query_monotone(x[i]) + x[i] * x[i] + C;
+        cht.add_line(-2 * x[i], dp[i] + x[i] * x[i]);
+        naive[i] = LLONG_MAX;
+        for (int j = 0; j < i; j++) {
+            naive[i] = std::min(naive[i], naive[j] + (x[i] - x[j]) * (x[i] - x[j]) + C);
+        }
+    }
+    EXPECT_EQ(dp, naive);
+}
+
+TEST_CASE(monotone_cht_large_values_and_doubles)
+{
+    cp::MonotoneCHT<cp::ll> cht; // intersections compared in i128
+    cp::ll big = 1000000000000LL;
+    cht.add_line(big, big * 1000);
+    cht.add_line(0, 0);
+    cht.add_line(-big, big * 1000);
+    EXPECT_EQ(cht.query(0), 0);
+    EXPECT_EQ(cht.query(2000), -big * 1000);
+    EXPECT_EQ(cht.query(-2000), -big * 1000);
+    // Intercepts near +-5e18: c.b - a.b = 1e19 overflows ll unless widened first.
+    cp::MonotoneCHT<cp::ll> wide;
+    wide.add_line(1, -5000000000000000000LL);
+    wide.add_line(0, -1000000000000000000LL);
+    wide.add_line(-1, 5000000000000000000LL);
+    EXPECT_EQ(wide.size(), 3);
+    EXPECT_EQ(wide.query(5000000000000000000LL), -1000000000000000000LL);
+    EXPECT_EQ(wide.query(0), -5000000000000000000LL);
+    EXPECT_EQ(wide.query_monotone(5000000000000000000LL), -1000000000000000000LL);
+    cp::MonotoneCHT<double> d;
+    d.add_line(1.5, 0);
+    d.add_line(-0.5, 1);
+    EXPECT_NEAR(d.query(2.0), 0.0, 1e-12);
+    EXPECT_NEAR(d.query(-1.0), -1.5, 1e-12);
+}
@@ -0,0 +1,73 @@
+#include "../framework/test_framework.hpp"
+#include "cp/dp/divide_conquer_dp.hpp"
+
+// Split a into k segments minimizing the sum of (segment sum)^2: the cost satisfies
+// the quadrangle inequality for non-negative a.
+TEST_CASE(partition_dp_matches_quadratic_dp)
+{
+    std::mt19937 rng(40);
+    for (int it = 0; it < 100; it++) {
+        int n = 1 + rng() % 40, k = 1 + rng() % n;
+        std::vector<cp::ll> pre(n + 1);
+        for (int i = 0; i < n; i++) {
+            pre[i + 1] = pre[i] + rng() % 100;
+        }
+        auto cost = [&](int l, int r) { return (pre[r] - pre[l]) * (pre[r] - pre[l]); };
+        const cp::ll none = LLONG_MAX;
+        std::vector<cp::ll> dp(n + 1, none);
+        dp[0] = 0;
+        for (int layer = 0; layer < k; layer++) {
+            std::vector<cp::ll> nxt(n + 1, none);
+            for (int i = 1; i <= n; i++) {
+                for (int j = 0; j < i; j++) {
+                    if (dp[j] != none) {
+                        nxt[i] = std::min(nxt[i], dp[j] + cost(j, i));
+                    }
+                }
+            }
+            dp = nxt;
+        }
+        EXPECT_EQ(cp::partition_dp<cp::ll>(n, k, cost), dp[n]);
+    }
+}
+
+TEST_CASE(divide_conquer_step_reports_monotone_argmin)
+{
+    // f(j, i) = (i - 2 j)^2 + j has a monotone argmin near i / 2
+    int n = 1000;
+    std::vector<cp::ll> best(n);
+    std::vector<int> arg(n);
+    auto f = [](int j, int i) { return (cp::ll)(i - 2 * j) * (i - 2 * j) + j; };
+    cp::divide_conquer_step<cp::ll>(n, f, best, arg);
+    for (int i = 0; i < n; i++) {
+        cp::ll want = LLONG_MAX;
+        int want_arg = -1;
+        for (int j = 0; j <= i; j++) {
+            if (f(j, i) < want) {
+                want = f(j, i), want_arg = j;
+            }
+        }
+        EXPECT_EQ(best[i], want);
+        EXPECT_EQ(arg[i], want_arg);
+    }
+    cp::divide_conquer_step<cp::ll>(0, f, best); // empty
+}
+
+TEST_CASE(partition_dp_large)
+{
+    // n = 1e5, k = 20: O(k n log n), with a brute check of the k = n and k = 1 ends
+    int n = 100000;
+    std::vector<cp::ll> pre(n + 1);
+    for (int i = 0; i < n; i++) {
+        pre[i + 1] = pre[i] + 1 + i % 7;
+    }
+    auto cost = [&](int l, int r) { return (pre[r] - pre[l]) * (pre[r] - pre[l]); };
+    EXPECT_EQ(cp::partition_dp<cp::ll>(n, 1, cost), pre[n] * pre[n]);
+    cp::ll parts = cp::partition_dp<cp::ll>(n, 20, cost);
+    EXPECT_TRUE(parts >= pre[n] * pre[n] / 20 && parts < pre[n] * pre[n] / 19);
+    cp::ll singles = 0;
+    for (int i = 0; i < 50; i++) {
+        singles += (pre[i + 1] - pre[i]) * (pre[i + 1] - pre[i]);
+    }
+    EXPECT_EQ(cp::partition_dp<cp::ll>(50, 50, cost), singles);
+}
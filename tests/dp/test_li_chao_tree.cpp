@@ -0,0 +1,81 @@
+#include "../framework/test_framework.hpp"
+#include "cp/dp/li_chao_tree.hpp"
+
+TEST_CASE(li_chao_tree_lines_and_segments_match_brute_force)
+{
+    std::mt19937 rng(40);
+    for (int it = 0; it < 200; it++) {
+        std::set<cp::ll> s;
+        int m = 1 + rng() % 40;
+        while ((int)s.size() < m) {
+            s.insert((cp::ll)(rng() % 2001) - 1000);
+        }
+        std::vector<cp::ll> xs(s.begin(), s.end());
+        cp::LiChaoTree<cp::ll> lc(xs);
+        std::vector<std::array<cp::ll, 4>> added; // k, b, x1, x2
+        for (int op = 0; op < 60; op++) {
+            cp::ll k = (cp::ll)(rng() % 201) - 100, b = (cp::ll)(rng() % 20001) - 10000;
+            if (rng() % 2) {
+                lc.add_line(k, b);
+                added.push_back({k, b, LLONG_MIN, LLONG_MAX});
+            }
+            else {
+                cp::ll x1 = (cp::ll)(rng() % 2201) - 1100;
+                cp::ll x2 = (cp::ll)(rng() % 2201) - 1100;
+                if (x1 > x2) {
+                    std::swap(x1, x2);
+                }
+                lc.add_segment(k, b, x1, x2);
+                added.push_back({k, b, x1, x2});
+            }
+            cp::ll x = xs[rng() % xs.size()], want = LLONG_MAX;
+            for (auto [ak, ab, x1, x2] : added) {
+                if (x1 <= x && x <= x2) {
+                    want = std::min(want, ak * x + ab);
+                }
+            }
+            EXPECT_EQ(lc.query(x), want);
+        }
+    }
+}
+
+TEST_CASE(dyn_li_chao_tree_matches_brute_force)
+{
+    std::mt19937_64 rng(41);
+    cp::ll lo = -1000000000, hi = 1000000000;
+    for (int it = 0; it < 100; it++) {
+        cp::DynLiChaoTree<cp::ll> lc(lo, hi);
+        EXPECT_EQ(lc.query(0), LLONG_MAX);
+        std::vector<std::pair<cp::ll, cp::ll>> added;
+        for (int op = 0; op < 100; op++) {
+            cp::ll k = (cp::ll)(rng() % 2000001) - 1000000;
+            cp::ll b = (cp::ll)(rng() % 2000000001) - 1000000000;
+            lc.add_line(k, b);
+            added.push_back({k, b});
+            cp::ll x = lo + (cp::ll)(rng() % (hi - lo + 1)), want = LLONG_MAX;
+            for (auto [ak, ab] : added) {
+                want = std::min(want, ak * x + ab);
+            }
+            EXPECT_EQ(lc.query(x), want);
+        }
+        EXPECT_TRUE(lc.nodes.size() <= added.size() + 1);
+        cp::ll want = LLONG_MAX;
+        for (auto [ak, ab] : added) {
+            want = std::min(want, ak * hi + ab);
+        }
+        EXPECT_EQ(lc.query(hi), want);
+    }
+}
+
+TEST_CASE(li_chao_tree_single_point_domain)
+{
+    cp::LiChaoTree<cp::ll> lc(std::vector<cp::ll>{7});
+    EXPECT_EQ(lc.query(7), LLONG_MAX);
+    lc.add_line(2, 1);
+    lc.add_segment(-1, 0, 8, 9); // misses the domain
+    EXPECT_EQ(lc.query(7), 15);
+    cp::DynLiChaoTree<cp::ll> d(5, 5);
+    d.add_line(3, -1);
+    d.add_line(4, -7);
+    EXPECT_EQ(d.query(5), 13);
+}
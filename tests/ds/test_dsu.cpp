@@ -1,3 +1,4 @@
+#include "../framework/property.hpp"
 #include "../framework/test_framework.hpp"
 #include "cp/ds/dsu.hpp"
 
@@ -59,3 +60,78 @@ TEST_CASE(dsu_merge_already_same)
     EXPECT_FALSE(d.same(0, 2));
     EXPECT_FALSE(d.same(0, 3));
 }
+
+TEST_CASE(concurrent_dsu_sequential)
+{
+    cp::ConcurrentDSU d(5);
+    EXPECT_TRUE(d.merge(0, 1));
+    EXPECT_TRUE(d.merge(3, 4));
+    EXPECT_FALSE(d.merge(1, 0));
+    EXPECT_TRUE(d.same(0, 1));
+    EXPECT_FALSE(d.same(1, 3));
+    EXPECT_TRUE(d.merge(1, 4));
+    EXPECT_TRUE(d.same(0, 3));
+    EXPECT_EQ(d.find(4), 0); // smaller index becomes the root
+    EXPECT_FALSE(d.same(2, 0));
+}
+
+TEST_CASE(concurrent_dsu_parallel_merges)
+{
+    int n = 20000;
+    cp::ConcurrentDSU d(n);
+    std::atomic<int> successful = 0;
+    std::vector<std::thread> pool;
+    for (int t = 0; t < 4; t++) {
+        // every thread merges the same chain, shifted so CAS races actually happen
+        pool.emplace_back([&, t] {
+            for (int i = 0; i + 1 < n; i++) {
+                int j = (i + t * 997) % (n - 1);
+                successful += d.merge(j, j + 1);
+            }
+        });
+    }
+    for (auto &th : pool) {
+        th.join();
+    }
+    EXPECT_EQ(successful.load(), n - 1); // exactly one winner per merge
+    for (int i = 0; i < n; i++) {
+        EXPECT_EQ(d.find(i), 0);
+    }
+}
+
+// kind 0: same(l, r) and the set sizes; kind 1: merge(l, r). The oracle keeps a set
+// label per element and relabels on merge, O(n) per merge.
+TEST_CASE(dsu_matches_naive_on_random_ops)
+{
+    auto run = [](const cp_test::OpCase &c) -> std::string {
+        cp::DSU d(c.n);
+        std::vector<int> label(c.n);
+        std::iota(label.begin(), label.end(), 0);
+        for (size_t i = 0; i < c.ops.size(); i++) {
+            auto &op = c.ops[i];
+            int u = op.l, v = op.r;
+            if (op.kind == 1) {
+                d.merge(u, v);
+                int from = label[v], to = label[u];
+                for (auto &x : label) {
+                    x = x == from ? to : x;
+                }
+                continue;
+            }
+            if (d.same(u, v) != (label[u] == label[v])) {
+                return "#" + std::to_string(i) + " same disagrees";
+            }
+            int size = std::count(label.begin(), label.end(), label[u]);
+            if (d.sizes[d.find(u)] != size) {
+                return "#" + std::to_string(i) + " size " +
+                       std::to_string(d.sizes[d.find(u)]) + ", naive " +
+                       std::to_string(size);
+            }
+        }
+        return "";
+    };
+    cp_test::check_property(
+        "dsu",
+        [](cp_test::Rng &rng, long long n) { return cp_test::random_op(rng, n, 2, 0); },
+        run);
+}
@@ -1,3 +1,4 @@
+#include "../framework/property.hpp"
 #include "../framework/test_framework.hpp"
 #include "cp/ds/dyn_seg_tree.hpp"
 
@@ -63,3 +64,41 @@ TEST_CASE(dyn_seg_tree_const_query)
     EXPECT_EQ(cst.query(0, 9), 20LL);
     EXPECT_EQ(cst.query(3, 6), 8LL);
 }
+
+// kind 0: query; kind 1: update. Index k of the case maps to coordinate lo + k * step
+// of a tree over [-1e12, 1e12], so ranges span up to 2e12 coordinates. The oracle keeps
+// the list of updates and sums v times the overlap of the two ranges, O(q) per query.
+TEST_CASE(dyn_seg_tree_matches_naive_on_random_ops)
+{
+    auto run = [](const cp_test::OpCase &c) -> std::string {
+        const cp::ll lo = -1'000'000'000'000, hi = 1'000'000'000'000;
+        const cp::ll step = (hi - lo) / c.n;
+        cp::DynSegTree<cp::ll> st(lo, hi);
+        std::vector<std::array<cp::ll, 3>> updates;
+        for (size_t i = 0; i < c.ops.size(); i++) {
+            auto &op = c.ops[i];
+            cp::ll l = lo + op.l * step, r = lo + op.r * step + step - 1;
+            if (op.kind == 1) {
+                st.update(l, r, op.v);
+                updates.push_back({l, r, op.v});
+                continue;
+            }
+            cp::ll want = 0;
+            for (auto [ul, ur, v] : updates) {
+                want += v * std::max(0LL, std::min(r, ur) - std::max(l, ul) + 1);
+            }
+            if (st.query(l, r) != want) {
+                return "#" + std::to_string(i) + " query = " +
+                       std::to_string(st.query(l, r)) + ", naive " +
+                       std::to_string(want);
+            }
+        }
+        return "";
+    };
+    cp_test::check_property(
+        "dyn_seg_tree",
+        [](cp_test::Rng &rng, long long n) {
+            return cp_test::random_op(rng, n, 2, 1000);
+        },
+        run);
+}
@@ -1,3 +1,4 @@
+#include "../framework/property.hpp"
 #include "../framework/test_framework.hpp"
 #include "cp/ds/fenwick.hpp"
 
@@ -86,3 +87,62 @@ TEST_CASE(offset_fenwick_assertions)
     EXPECT_ABORT(cp::OffsetFenwick<int> fw(3, 7); fw.query(4, 8)); // qr > hi
     EXPECT_ABORT(cp::OffsetFenwick<int> fw(3, 7); fw.query(6, 4)); // ql > qr
 }
+
+// kind 0: add(l, v); kind 1: query(l, r).
+static std::string fenwick_vs_naive(const cp_test::OpCase &c, long long buggy_from)
+{
+    cp::Fenwick<long long> fw(c.n);
+    std::vector<long long> naive(c.n);
+    for (size_t i = 0; i < c.ops.size(); i++) {
+        auto &op = c.ops[i];
+        if (op.kind == 0) {
+            fw.add(op.l, op.v);
+            naive[op.l] += op.l < buggy_from ? op.v : 0;
+            continue;
+        }
+        long long want = 0;
+        for (long long k = op.l; k <= op.r; k++) {
+            want += naive[k];
+        }
+        if (fw.query(op.l, op.r) != want) {
+            return "#" + std::to_string(i) + " query = " +
+                   std::to_string(fw.query(op.l, op.r)) + ", naive " +
+                   std::to_string(want);
+        }
+    }
+    return "";
+}
+
+TEST_CASE(fenwick_matches_naive_on_random_ops)
+{
+    cp_test::check_property(
+        "fenwick",
+        [](cp_test::Rng &rng, long long n) {
+            return cp_test::random_op(rng, n, 2, 1000000000);
+        },
+        [](const cp_test::OpCase &c) { return fenwick_vs_naive(c, c.n); });
+}
+
+// Property framework self-check: an oracle that drops adds at index >= 3 must be
+// caught and shrunk to the smallest witness, one add at 3 and one query of [3, 3].
+TEST_CASE(fenwick_property_shrinks_to_minimal_case)
+{
+    cp_test::OpCase c;
+    std::string msg;
+    uint64_t seed;
+    bool ok = cp_test::find_counterexample(
+        [](cp_test::Rng &rng, long long n) {
+            return cp_test::random_op(rng, n, 2, 100);
+        },
+        [](const cp_test::OpCase &oc) { return fenwick_vs_naive(oc, 3); },
+        cp_test::PropertyOptions{},
+        c,
+        msg,
+        seed);
+    EXPECT_FALSE(ok);
+    EXPECT_FALSE(msg.empty());
+    EXPECT_EQ(c.n, 4LL);
+    EXPECT_EQ(c.ops.size(), 2u);
+    EXPECT_TRUE(c.ops[0].kind == 0 && c.ops[0].l == 3 && std::abs(c.ops[0].v) == 1);
+    EXPECT_TRUE(c.ops[1].kind == 1 && c.ops[1].l == 3 && c.ops[1].r == 3);
+}
@@ -1,3 +1,4 @@
+#include "../framework/property.hpp"
 #include "../framework/test_framework.hpp"
 #include "cp/ds/range_seg_tree.hpp"
 
@@ -213,3 +214,66 @@ TEST_CASE(range_seg_tree_assertions)
     EXPECT_ABORT(st.query(0, 10));
     EXPECT_ABORT(st.query(5, 3));
 }
+
+// Differential check of RangeSegTree<Policy> against a plain array: kind 0 queries
+// [l, r], any other kind applies make_lazy(op) to [l, r]. The oracle applies the lazy
+// to each element on its own (size 1) and never merges, so it exercises none of the
+// tree's push-down, merge or size scaling. The tree is built from a fixed array so the
+// build path is covered too.
+template <typename Policy, typename MakeLazy>
+static void check_range_seg_tree_policy(const std::string &name,
+                                        int kinds,
+                                        MakeLazy make_lazy)
+{
+    auto run = [&](const cp_test::OpCase &c) -> std::string {
+        std::vector<typename Policy::T> naive(c.n);
+        for (int k = 0; k < c.n; k++) {
+            naive[k] = (k * 7919) % 23 - 11;
+        }
+        cp::RangeSegTree<Policy> st(naive);
+        for (size_t i = 0; i < c.ops.size(); i++) {
+            auto &op = c.ops[i];
+            if (op.kind != 0) {
+                auto lazy = make_lazy(op);
+                st.update(op.l, op.r, lazy);
+                for (auto k = op.l; k <= op.r; k++) {
+                    naive[k] = Policy::apply(naive[k], lazy, 1);
+                }
+                continue;
+            }
+            auto want = Policy::query_oob;
+            for (auto k = op.l; k <= op.r; k++) {
+                want = Policy::combine(want, naive[k]);
+            }
+            if (st.query(op.l, op.r) != want) {
+                return "#" + std::to_string(i) + " query = " +
+                       std::to_string(st.query(op.l, op.r)) + ", naive " +
+                       std::to_string(want);
+            }
+        }
+        return "";
+    };
+    cp_test::check_property(
+        name,
+        [&](cp_test::Rng &rng, long long n) {
+            return cp_test::random_op(rng, n, kinds, 1000);
+        },
+        run);
+}
+
+TEST_CASE(range_seg_tree_policies_match_naive_on_random_ops)
+{
+    auto add = [](const cp_test::Op &op) { return op.v; };
+    auto set = [](const cp_test::Op &op) { return std::optional<cp::ll>(op.v); };
+    // kind 1 adds, kind 2 sets
+    auto add_set = [](const cp_test::Op &op) {
+        return op.kind == 1 ? std::pair<cp::ll, std::optional<cp::ll>>{op.v, {}}
+                            : std::pair<cp::ll, std::optional<cp::ll>>{0, op.v};
+    };
+    check_range_seg_tree_policy<cp::LongSumAddPolicy>("sum_add", 2, add);
+    check_range_seg_tree_policy<cp::LongMinAddPolicy>("min_add", 2, add);
+    check_range_seg_tree_policy<cp::LongSumSetPolicy>("sum_set", 2, set);
+    check_range_seg_tree_policy<cp::LongMinSetPolicy>("min_set", 2, set);
+    check_range_seg_tree_policy<cp::LongSumAddSetPolicy>("sum_add_set", 3, add_set);
+    check_range_seg_tree_policy<cp::LongMinAddSetPolicy>("min_add_set", 3, add_set);
+}
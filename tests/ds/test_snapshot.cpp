@@ -0,0 +1,182 @@
+#include "../framework/test_framework.hpp"
+#include "cp/ds/snapshot.hpp"
+
+// A fresh path under /tmp, removed (with its .tmp sibling) when the test ends.
+struct TempPath
+{
+    std::string path;
+
+    TempPath()
+    {
+        char buf[] = "/tmp/cp_test_snapshot_XXXXXX";
+        close(mkstemp(buf));
+        path = buf;
+    }
+
+    ~TempPath()
+    {
+        unlink(path.c_str());
+        unlink((path + ".tmp").c_str());
+    }
+};
+
+static std::string file_bytes(const std::string &path)
+{
+    std::ifstream f(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(f), {});
+}
+
+static void overwrite(const std::string &path, const std::string &bytes)
+{
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << bytes;
+}
+
+constexpr auto min_ll = [](cp::ll a, cp::ll b) { return std::min(a, b); };
+
+TEST_CASE(snapshot_seg_tree_round_trip)
+{
+    std::mt19937 rng(49);
+    std::vector<cp::ll> a(1000);
+    for (auto &x : a) {
+        x = (cp::ll)(rng() % 2000) - 1000;
+    }
+    cp::SegTree<cp::ll, min_ll, cp::INF64> st(a);
+    TempPath tmp;
+    EXPECT_TRUE(cp::save_snapshot(tmp.path, st));
+    for (bool verify : {true, false}) {
+        auto v = cp::SegTreeView<cp::ll, min_ll, cp::INF64>::open(
+            tmp.path, cp::SnapshotMode::read_only, verify);
+        EXPECT_TRUE(v.has_value());
+        EXPECT_EQ(v->n, 1000);
+        for (int q = 0; q < 2000; q++) {
+            int l = rng() % 1000, r = rng() % 1000;
+            if (l > r) {
+                std::swap(l, r);
+            }
+            EXPECT_EQ(v->query(l, r), st.query(l, r));
+        }
+    }
+}
+
+TEST_CASE(snapshot_copy_on_write_leaves_file_unchanged)
+{
+    cp::SegTree<cp::ll, std::plus<cp::ll>{}> st(std::vector<cp::ll>{1, 2, 3, 4, 5});
+    TempPath tmp;
+    EXPECT_TRUE(cp::save_snapshot(tmp.path, st));
+    std::string before = file_bytes(tmp.path);
+    {
+        auto v = cp::SegTreeView<cp::ll, std::plus<cp::ll>{}>::open(
+            tmp.path, cp::SnapshotMode::copy_on_write);
+        EXPECT_TRUE(v.has_value());
+        v->update(2, 100);
+        st.update(2, 100);
+        EXPECT_EQ(v->query(0, 4), 112);
+        EXPECT_EQ(v->query(1, 2), st.query(1, 2));
+        auto moved = std::move(*v); // the mapping moves with the view
+        EXPECT_EQ(moved.query(2, 2), 100);
+    }
+    EXPECT_TRUE(file_bytes(tmp.path) == before);
+    auto again = cp::SegTreeView<cp::ll, std::plus<cp::ll>{}>::open(tmp.path);
+    EXPECT_EQ(again->query(0, 4), 15);
+}
+
+// Leaves pending lazies at inner nodes, so the view must compose them on the way down.
+TEST_CASE(snapshot_range_seg_tree_applies_pending_lazies)
+{
+    std::mt19937 rng(50);
+    const int n = 300;
+    cp::RangeSegTree<cp::LongMinAddSetPolicy> st(std::vector<cp::ll>(n, 7));
+    std::vector<cp::ll> naive(n, 7);
+    for (int i = 0; i < 500; i++) {
+        int l = rng() % n, r = rng() % n;
+        if (l > r) {
+            std::swap(l, r);
+        }
+        cp::ll x = (cp::ll)(rng() % 100) - 50;
+        bool set = rng() % 3 == 0;
+        using L = cp::LongMinAddSetPolicy::L;
+        st.update(l, r, set ? L{0, x} : L{x, std::nullopt});
+        for (int j = l; j <= r; j++) {
+            naive[j] = set ? x : naive[j] + x;
+        }
+    }
+    TempPath tmp;
+    EXPECT_TRUE(cp::save_snapshot(tmp.path, st));
+    auto v = cp::RangeSegTreeView<cp::LongMinAddSetPolicy>::open(tmp.path);
+    EXPECT_TRUE(v.has_value());
+    for (int l = 0; l < n; l += 7) {
+        for (int r = l; r < n; r += 11) {
+            EXPECT_EQ(v->query(l, r), *std::min_element(&naive[l], &naive[r] + 1));
+        }
+    }
+}
+
+TEST_CASE(snapshot_fenwick_and_dsu)
+{
+    cp::Fenwick<cp::ll> fw(std::vector<cp::ll>{5, -1, 4, 0, 2, 9});
+    cp::DSU dsu(8);
+    dsu.merge(0, 1);
+    dsu.merge(2, 3);
+    dsu.merge(1, 3);
+    dsu.merge(6, 7);
+    TempPath fw_path, dsu_path;
+    EXPECT_TRUE(cp::save_snapshot(fw_path.path, fw));
+    EXPECT_TRUE(cp::save_snapshot(dsu_path.path, dsu));
+
+    auto f = cp::FenwickView<cp::ll>::open(fw_path.path);
+    EXPECT_EQ(f->query(5), 19);
+    EXPECT_EQ(f->query(1, 3), 3);
+    auto g =
+        cp::FenwickView<cp::ll>::open(fw_path.path, cp::SnapshotMode::copy_on_write);
+    g->add(1, 10);
+    EXPECT_EQ(g->query(1, 3), 13);
+    EXPECT_EQ(f->query(1, 3), 3); // a private copy: the shared mapping is untouched
+
+    auto d = cp::DSUView::open(dsu_path.path);
+    EXPECT_TRUE(d->same(0, 2));
+    EXPECT_FALSE(d->same(0, 6));
+    EXPECT_EQ(d->size(3), 4);
+    EXPECT_EQ(d->size(5), 1);
+    auto e = cp::DSUView::open(dsu_path.path, cp::SnapshotMode::copy_on_write);
+    e->merge(5, 6);
+    EXPECT_EQ(e->size(7), 3);
+    EXPECT_FALSE(d->same(5, 6));
+}
+
+TEST_CASE(snapshot_rejects_bad_files)
+{
+    cp::Fenwick<cp::ll> fw(std::vector<cp::ll>(100, 3));
+    TempPath tmp;
+    EXPECT_TRUE(cp::save_snapshot(tmp.path, fw));
+    std::string good = file_bytes(tmp.path), why;
+
+    EXPECT_FALSE(cp::FenwickView<int>::open(tmp.path, {}, true, &why));
+    EXPECT_EQ(why, std::string("snapshot holds another structure or element type"));
+    EXPECT_FALSE(cp::DSUView::open(tmp.path, {}, true, &why));
+    EXPECT_FALSE(cp::FenwickView<cp::ll>::open(tmp.path + ".missing", {}, true, &why));
+    EXPECT_TRUE(why.rfind("cannot open", 0) == 0);
+
+    std::string bad = good;
+    bad[sizeof(cp::SnapshotHeader) + 17] ^= 1; // one bit of payload
+    overwrite(tmp.path, bad);
+    EXPECT_FALSE(cp::FenwickView<cp::ll>::open(tmp.path, {}, true, &why));
+    EXPECT_EQ(why, std::string("snapshot checksum mismatch"));
+    EXPECT_TRUE(cp::FenwickView<cp::ll>::open(tmp.path, {}, false).has_value());
+
+    overwrite(tmp.path, good.substr(0, good.size() - 64));
+    EXPECT_FALSE(cp::FenwickView<cp::ll>::open(tmp.path, {}, false, &why));
+    EXPECT_EQ(why, std::string("snapshot truncated or size fields corrupt"));
+
+    bad = good;
+    bad[8] = 2; // version
+    overwrite(tmp.path, bad);
+    EXPECT_FALSE(cp::FenwickView<cp::ll>::open(tmp.path, {}, true, &why));
+    EXPECT_EQ(why, std::string("snapshot version 2, expected 1"));
+
+    overwrite(tmp.path, std::string(200, 'x'));
+    EXPECT_FALSE(cp::FenwickView<cp::ll>::open(tmp.path, {}, true, &why));
+    EXPECT_EQ(why, std::string("not a snapshot file"));
+
+    EXPECT_FALSE(cp::save_snapshot("/nonexistent/dir/x.snap", fw, &why));
+    EXPECT_TRUE(why.rfind("cannot create", 0) == 0);
+}
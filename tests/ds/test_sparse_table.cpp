@@ -0,0 +1,118 @@
+#include "../framework/test_framework.hpp"
+#include "cp/ds/sparse_table.hpp"
+
+constexpr auto min_ll = [](cp::ll a, cp::ll b) { return std::min(a, b); };
+constexpr auto gcd_ll = [](cp::ll a, cp::ll b) { return std::gcd(a, b); };
+constexpr auto concat = [](std::string a, const std::string &b) { return a += b; };
+
+// Sizes around the power-of-two and 64-wide block boundaries the tables split on.
+static const int sizes[] = {1, 2, 3, 5, 8, 63, 64, 65, 127, 128, 129, 300};
+
+TEST_CASE(sparse_table_min_and_gcd)
+{
+    cp::SparseTable<cp::ll, min_ll> st({5, 2, 8, 1, 9, 3});
+    EXPECT_EQ(st.query(0, 5), 1);
+    EXPECT_EQ(st.query(0, 2), 2);
+    EXPECT_EQ(st.query(4, 5), 3);
+    EXPECT_EQ(st.query(4, 4), 9);
+    cp::SparseTable<cp::ll, gcd_ll> g({12, 18, 24, 7});
+    EXPECT_EQ(g.query(0, 2), 6);
+    EXPECT_EQ(g.query(1, 3), 1);
+}
+
+TEST_CASE(sparse_table_matches_naive)
+{
+    std::mt19937 rng(50);
+    for (int n : sizes) {
+        std::vector<cp::ll> a(n);
+        for (auto &x : a) {
+            x = (cp::ll)(rng() % 100) * 6;
+        }
+        cp::SparseTable<cp::ll, min_ll> mn(a);
+        cp::SparseTable<cp::ll, gcd_ll> g(a);
+        for (int l = 0; l < n; l++) {
+            cp::ll m = a[l], d = a[l];
+            for (int r = l; r < n; r++) {
+                m = std::min(m, a[r]), d = std::gcd(d, a[r]);
+                EXPECT_EQ(mn.query(l, r), m);
+                EXPECT_EQ(g.query(l, r), d);
+            }
+        }
+    }
+}
+
+// String concatenation is associative but neither commutative nor idempotent, so any
+// overlap or misordering of the two halves shows up in the result.
+TEST_CASE(disjoint_sparse_table_matches_naive)
+{
+    std::mt19937 rng(51);
+    for (int n : sizes) {
+        std::vector<cp::ll> a(n);
+        std::vector<std::string> s(n);
+        for (int i = 0; i < n; i++) {
+            a[i] = (cp::ll)(rng() % 2001) - 1000;
+            s[i] = std::string(1, char('a' + rng() % 26));
+        }
+        cp::DisjointSparseTable<cp::ll, std::plus<cp::ll>{}> sum(a);
+        cp::DisjointSparseTable<std::string, concat> cat(s);
+        for (int l = 0; l < n; l++) {
+            cp::ll total = 0;
+            std::string text;
+            for (int r = l; r < n; r++) {
+                total += a[r], text += s[r];
+                EXPECT_EQ(sum.query(l, r), total);
+                EXPECT_EQ(cat.query(l, r), text);
+            }
+        }
+    }
+}
+
+TEST_CASE(block_sparse_table_min_max_argmin)
+{
+    std::mt19937 rng(52);
+    for (int n : sizes) {
+        std::vector<int> a(n);
+        for (auto &x : a) {
+            x = rng() % 10; // many ties
+        }
+        cp::BlockSparseTable<int> mn(a);
+        cp::BlockSparseTable<int, std::greater<int>{}> mx(a);
+        for (int l = 0; l < n; l++) {
+            int lo = l, hi = l;
+            for (int r = l; r < n; r++) {
+                lo = a[r] < a[lo] ? r : lo;
+                hi = a[r] > a[hi] ? r : hi;
+                EXPECT_EQ(mn.argmin(l, r), lo); // leftmost on ties
+                EXPECT_EQ(mn.query(l, r), a[lo]);
+                EXPECT_EQ(mx.argmin(l, r), hi);
+            }
+        }
+    }
+}
+
+TEST_CASE(block_sparse_table_large_random)
+{
+    std::mt19937 rng(53);
+    const int n = 200000;
+    std::vector<cp::ll> a(n);
+    for (auto &x : a) {
+        x = rng();
+    }
+    cp::SparseTable<cp::ll, min_ll> ref(a);
+    cp::BlockSparseTable<cp::ll> blk(a);
+    for (int q = 0; q < 100000; q++) {
+        int l = rng() % n, r = rng() % n;
+        if (l > r) {
+            std::swap(l, r);
+        }
+        EXPECT_EQ(blk.query(l, r), ref.query(l, r));
+    }
+}
+
+TEST_CASE(sparse_table_asserts_on_bad_range)
+{
+    cp::SparseTable<cp::ll, min_ll> st({1, 2, 3});
+    EXPECT_ABORT(st.query(2, 1));
+    cp::BlockSparseTable<int> blk({1, 2, 3});
+    EXPECT_ABORT(blk.query(0, 3));
+}
@@ -0,0 +1,167 @@
+// Benchmark baselines - stores BENCH_CASE results and compares later runs against them.
+//
+// Baseline file: one line per measurement, whitespace-separated,
+//   <name> <ops> <ns/op sample> <ns/op sample> ...
+// so every repetition is kept, not just the median.
+//
+// Comparison: for each measurement present in both runs, a one-sided Mann-Whitney U
+// test asks whether the new samples tend to be larger (slower) than the baseline ones.
+// It uses only ranks, so one noisy repetition cannot swing it the way it swings a mean,
+// and it assumes nothing about the timing distribution. A measurement regresses when
+//   p < alpha  and  new median > baseline median * (1 + threshold),
+// i.e. the slowdown is both statistically significant and large enough to matter.
+// The p-value comes from the normal approximation with tie correction, which is
+// adequate from about 8 repetitions per side; with fewer, small p-values are
+// unreachable and nothing is flagged.
+//
+// Runner flags (after --bench):
+//   --save-baseline=PATH   write this run's results to PATH
+//   --baseline=PATH        compare against PATH; exit nonzero on any regression
+//   --threshold=X          relative slowdown that counts (default 0.05)
+//   --alpha=X              significance level (default 0.01)
+#pragma once
+#include "bench_framework.hpp"
+#include <cmath>
+#include <map>
+
+namespace cp_test
+{
+struct BaselineOptions
+{
+    std::string save, compare;
+    double threshold = 0.05;
+    double alpha = 0.01;
+};
+
+inline bool save_baseline(const std::string &path,
+                          const std::vector<BenchResult> &results)
+{
+    std::ofstream out(path);
+    out.precision(17);
+    for (auto &r : results) {
+        out << r.name << " " << r.ops;
+        for (double s : r.samples) {
+            out << " " << s;
+        }
+        out << "\n";
+    }
+    return bool(out);
+}
+
+// Returns false if the file cannot be read.
+inline bool load_baseline(const std::string &path,
+                          std::map<std::string, BenchResult> &out)
+{
+    std::ifstream in(path);
+    if (!in) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream ls(line);
+        BenchResult r;
+        if (!(ls >> r.name >> r.ops)) {
+            continue;
+        }
+        for (double s; ls >> s;) {
+            r.samples.push_back(s);
+        }
+        r.summarize();
+        out[r.name] = r;
+    }
+    return true;
+}
+
+// One-sided Mann-Whitney U test: p-value for "b tends to be larger than a".
+// O((n + m) log(n + m)) time.
+inline double mann_whitney_greater(const std::vector<double> &a,
+                                   const std::vector<double> &b)
+{
+    size_t n1 = a.size(), n2 = b.size(), n = n1 + n2;
+    if (n1 == 0 || n2 == 0) {
+        return 1;
+    }
+    std::vector<std::pair<double, int>> all; // (value, 1 if from b)
+    for (double x : a) {
+        all.push_back({x, 0});
+    }
+    for (double x : b) {
+        all.push_back({x, 1});
+    }
+    std::sort(all.begin(), all.end());
+    // midranks for ties; tie_term accumulates t^3 - t per tie group
+    double rank_sum_b = 0, tie_term = 0;
+    for (size_t i = 0; i < n;) {
+        size_t j = i;
+        while (j < n && all[j].first == all[i].first) {
+            j++;
+        }
+        double mid = (i + 1 + j) / 2.0, t = j - i;
+        for (size_t k = i; k < j; k++) {
+            rank_sum_b += all[k].second ? mid : 0;
+        }
+        tie_term += t * t * t - t;
+        i = j;
+    }
+    double u = rank_sum_b - n2 * (n2 + 1) / 2.0;
+    double mean = n1 * n2 / 2.0;
+    double var = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1.0)));
+    if (var <= 0) {
+        return 1;
+    }
+    double z = (u - mean - 0.5) / std::sqrt(var); // continuity correction
+    return 0.5 * std::erfc(z / std::sqrt(2.0));
+}
+
+// Prints one line per measurement found in the baseline and returns the number of
+// regressions. Measurements missing from the baseline are listed as new.
+inline int compare_to_baseline(const std::vector<BenchResult> &results,
+                               const std::map<std::string, BenchResult> &baseline,
+                               const BaselineOptions &opt)
+{
+    printf("\n%-48s %12s %12s %8s %8s  %s\n",
+           "benchmark",
+           "base ns/op",
+           "new ns/op",
+           "change",
+           "p",
+           "verdict");
+    int regressions = 0;
+    for (auto &r : results) {
+        auto it = baseline.find(r.name);
+        if (it == baseline.end()) {
+            printf("%-48s %12s %12.2f %8s %8s  new\n",
+                   r.name.c_str(),
+                   "-",
+                   r.median,
+                   "-",
+                   "-");
+            continue;
+        }
+        const BenchResult &b = it->second;
+        double change = b.median > 0 ? r.median / b.median - 1 : 0;
+        double p_slower = mann_whitney_greater(b.samples, r.samples);
+        double p_faster = mann_whitney_greater(r.samples, b.samples);
+        const char *verdict = "same";
+        if (p_slower < opt.alpha && change > opt.threshold) {
+            verdict = "REGRESSED";
+            regressions++;
+        }
+        else if (p_faster < opt.alpha && change < -opt.threshold) {
+            verdict = "improved";
+        }
+        printf("%-48s %12.2f %12.2f %+7.1f%% %8.4f  %s\n",
+               r.name.c_str(),
+               b.median,
+               r.median,
+               100 * change,
+               std::min(p_slower, p_faster),
+               verdict);
+    }
+    printf("\n%d regression(s) beyond %.1f%% at alpha = %g.\n",
+           regressions,
+           100 * opt.threshold,
+           opt.alpha);
+    return regressions;
+}
+} // namespace cp_test
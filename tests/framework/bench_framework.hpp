@@ -0,0 +1,391 @@
+// Benchmark framework - registration-based micro-benchmarks, run by test_main.cpp
+// with --bench.
+//
+// How it works:
+//   BENCH_CASE(name) defines a static function taking a BenchState & and registers it
+//   the same way TEST_CASE does. The body builds its input, then calls
+//   state.measure(ops, fn) once per variant: fn runs `warmup` times untimed, then
+//   `reps` times timed, and must perform `ops` operations per call. Each timed call
+//   gives one ns/op sample; the report shows the median and p99 (nearest rank) over
+//   the samples, and ops/s at the median.
+//
+// How to add a benchmark:
+//   1. Create bench/<category>/bench_<module>.cpp
+//   2. Include "../../tests/framework/bench_framework.hpp" and the header under test
+//   3. Write BENCH_CASE blocks; pass results to DoNotOptimize so the work is kept
+//   4. Run make bench - the Makefile auto-discovers all .cpp files under bench/ and
+//      links them with tests/test_main.cpp, built with -O3 -march=native -DNDEBUG
+//
+// Runner flags (after --bench):
+//   --filter=S      run only benchmarks whose name contains S
+//   --reps=N        timed repetitions per measurement (default 10)
+//   --warmup=N      untimed repetitions before them (default 1)
+//   --format=F      table (default), csv or json
+//   --out=PATH      write the csv / json report to PATH; the table still goes to stdout
+//   --perf          add hardware counters per op (cycles, instructions, cache and
+//                   branch misses) via perf_event_open, where the kernel allows it
+//
+// Counters: measure() returns its BenchResult, and
+//   state.measure(...).add_stats(st.stats());
+// attaches a structure's instrumentation counters (cp/core/stats.hpp, make bench
+// STATS=1) as per-op averages over every call of fn, warmup included, so reset_stats()
+// right before measure(). Zero counters are omitted.
+//
+// A body may throw (e.g. when backends disagree on a checksum); the case is then
+// reported as FAIL and the run exits nonzero.
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace cp_test
+{
+// Forces value to be computed and treated as used, without emitting any instruction:
+// the empty asm claims to read it (from a register or memory) and to clobber memory.
+template <typename T>
+inline void DoNotOptimize(const T &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+struct BenchOptions
+{
+    std::string filter;
+    int reps = 10;
+    int warmup = 1;
+    std::string format = "table";
+    std::string out;
+    bool perf = false;
+};
+
+struct BenchResult
+{
+    std::string name;
+    long long ops = 0;
+    std::vector<double> samples; // ns/op of every timed repetition, in run order
+    double median = 0, p99 = 0;  // ns/op
+    long long calls = 0;         // calls of the measured function, warmup included
+    std::vector<std::pair<std::string, double>> counters; // per op
+
+    double ops_per_sec() const
+    {
+        return median > 0 ? 1e9 / median : 0;
+    }
+
+    // Sets median and p99 (nearest rank, the ceil(0.99 k)-th smallest) from samples.
+    void summarize()
+    {
+        std::vector<double> sorted = samples;
+        std::sort(sorted.begin(), sorted.end());
+        size_t k = sorted.size();
+        if (k > 0) {
+            median = k % 2 ? sorted[k / 2] : (sorted[k / 2 - 1] + sorted[k / 2]) / 2;
+            p99 = sorted[(99 * k + 99) / 100 - 1];
+        }
+    }
+
+    // Adds every nonzero counter of s (anything with each(f(name, total))) divided by
+    // the number of operations performed across all calls.
+    template <typename S>
+    BenchResult &add_stats(const S &s)
+    {
+        s.each([&](const char *counter, long long total) {
+            if (total != 0) {
+                counters.push_back({counter, (double)total / (ops * calls)});
+            }
+        });
+        return *this;
+    }
+};
+
+// Hardware event counters for the calling thread, user space only. Events the kernel
+// refuses (no PMU in a VM, perf_event_paranoid too high) stay closed and are skipped.
+class PerfCounters
+{
+public:
+    static constexpr int count = 4;
+    static constexpr const char *names[count] = {
+        "cycles", "instructions", "cache_misses", "branch_misses"};
+
+    PerfCounters()
+    {
+#ifdef __linux__
+        const unsigned long long configs[count] = {PERF_COUNT_HW_CPU_CYCLES,
+                                                   PERF_COUNT_HW_INSTRUCTIONS,
+                                                   PERF_COUNT_HW_CACHE_MISSES,
+                                                   PERF_COUNT_HW_BRANCH_MISSES};
+        for (int i = 0; i < count; i++) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = configs[i];
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        }
+#endif
+    }
+
+    ~PerfCounters()
+    {
+        for (int fd : fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    bool available() const
+    {
+        return std::any_of(fds, fds + count, [](int fd) { return fd >= 0; });
+    }
+
+    // Counting accumulates between start() and stop(), across several pairs.
+    void start()
+    {
+#ifdef __linux__
+        for (int fd : fds) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    void stop()
+    {
+#ifdef __linux__
+        for (int fd : fds) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+#endif
+    }
+
+    // Calls f(name, total) for every open event.
+    template <typename F>
+    void each(F &&f) const
+    {
+        for (int i = 0; i < count; i++) {
+            long long value = 0;
+            if (fds[i] >= 0 && read(fds[i], &value, sizeof(value)) == sizeof(value)) {
+                f(names[i], value);
+            }
+        }
+    }
+
+private:
+    int fds[count] = {-1, -1, -1, -1};
+};
+
+class BenchState
+{
+public:
+    BenchState(std::string name, const BenchOptions &options)
+        : case_name(std::move(name)),
+          opt(options)
+    {
+    }
+
+    // Times fn, which performs ops operations per call; reported under the case name.
+    // The returned reference is valid until the next measure() call.
+    template <typename F>
+    BenchResult &measure(long long ops, F &&fn)
+    {
+        return measure("", ops, fn);
+    }
+
+    // Same, reported as case_name/label, for cases that compare several variants.
+    template <typename F>
+    BenchResult &measure(const std::string &label, long long ops, F &&fn)
+    {
+        BenchResult r;
+        r.name = label.empty() ? case_name : case_name + "/" + label;
+        r.ops = std::max(ops, 1LL);
+        r.calls = opt.warmup + opt.reps;
+        for (int i = 0; i < opt.warmup; i++) {
+            fn();
+        }
+        std::unique_ptr<PerfCounters> perf;
+        if (opt.perf) {
+            perf = std::make_unique<PerfCounters>();
+        }
+        for (int i = 0; i < opt.reps; i++) {
+            if (perf) {
+                perf->start();
+            }
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto end = std::chrono::steady_clock::now();
+            if (perf) {
+                perf->stop();
+            }
+            double ns = std::chrono::duration<double, std::nano>(end - start).count();
+            r.samples.push_back(ns / r.ops);
+        }
+        r.summarize();
+        if (perf) {
+            perf->each([&](const char *counter, long long total) {
+                r.counters.push_back({counter, (double)total / (r.ops * opt.reps)});
+            });
+        }
+        results.push_back(std::move(r));
+        return results.back();
+    }
+
+    std::vector<BenchResult> results;
+
+private:
+    std::string case_name;
+    const BenchOptions &opt;
+};
+
+struct BenchCase
+{
+    std::string name;
+    std::function<void(BenchState &)> fn;
+};
+
+inline std::vector<BenchCase> &BenchRegistry()
+{
+    static std::vector<BenchCase> reg;
+    return reg;
+}
+
+struct BenchRegistrar
+{
+    BenchRegistrar(const std::string &name, std::function<void(BenchState &)> fn)
+    {
+        BenchRegistry().push_back({name, fn});
+    }
+};
+
+#define BENCH_CASE(name)                                                               \
+    static void _bench_##name(::cp_test::BenchState &state);                          \
+    static ::cp_test::BenchRegistrar _bench_reg_##name(#name, _bench_##name);          \
+    static void _bench_##name([[maybe_unused]] ::cp_test::BenchState &state)
+
+inline std::string bench_csv(const std::vector<BenchResult> &results)
+{
+    std::ostringstream os;
+    os << "name,ops,reps,median_ns_per_op,p99_ns_per_op,ops_per_sec,counters\n";
+    for (auto &r : results) {
+        os << r.name << "," << r.ops << "," << r.samples.size() << ",";
+        os << r.median << "," << r.p99 << "," << r.ops_per_sec() << ",";
+        for (size_t i = 0; i < r.counters.size(); i++) { // name=value;name=value
+            os << (i ? ";" : "") << r.counters[i].first << "=" << r.counters[i].second;
+        }
+        os << "\n";
+    }
+    return os.str();
+}
+
+inline std::string bench_json(const std::vector<BenchResult> &results)
+{
+    std::ostringstream os;
+    os << "{\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        auto &r = results[i];
+        os << (i ? ",\n" : "\n") << "    {\"name\": \"" << r.name << "\", ";
+        os << "\"ops\": " << r.ops << ", \"median_ns_per_op\": " << r.median << ", ";
+        os << "\"p99_ns_per_op\": " << r.p99 << ", ";
+        os << "\"ops_per_sec\": " << r.ops_per_sec() << ", \"counters\": {";
+        for (size_t j = 0; j < r.counters.size(); j++) {
+            os << (j ? ", " : "") << "\"" << r.counters[j].first << "\": ";
+            os << r.counters[j].second;
+        }
+        os << "}, \"samples\": [";
+        for (size_t j = 0; j < r.samples.size(); j++) {
+            os << (j ? ", " : "") << r.samples[j];
+        }
+        os << "]}";
+    }
+    os << "\n  ]\n}\n";
+    return os.str();
+}
+
+inline void print_bench_row(const BenchResult &r)
+{
+    printf("%-48s %12.2f %12.2f %14.0f",
+           r.name.c_str(),
+           r.median,
+           r.p99,
+           r.ops_per_sec());
+    for (auto &[counter, value] : r.counters) {
+        printf("  %s=%.3g", counter.c_str(), value);
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+// Runs every registered benchmark matching the filter and reports them. Returns the
+// process exit code: nonzero if a case threw or the report could not be written.
+inline int run_benchmarks(const BenchOptions &opt, std::vector<BenchResult> &all)
+{
+    bool table = opt.format == "table" || !opt.out.empty();
+    if (opt.format != "table" && opt.format != "csv" && opt.format != "json") {
+        std::cerr << "unknown --format=" << opt.format << "\n";
+        return 1;
+    }
+    if (table) {
+        printf("%-48s %12s %12s %14s\n",
+               "benchmark",
+               "median ns/op",
+               "p99 ns/op",
+               "ops/s");
+    }
+    if (opt.perf && !PerfCounters().available()) {
+        std::cerr << "--perf: perf_event_open refused, no hardware counters\n";
+    }
+    int failed = 0;
+    for (auto &bc : BenchRegistry()) {
+        if (bc.name.find(opt.filter) == std::string::npos) {
+            continue;
+        }
+        BenchState state(bc.name, opt);
+        try {
+            bc.fn(state);
+        }
+        catch (const std::exception &e) {
+            std::cout << "[FAIL] " << bc.name << ": " << e.what() << "\n";
+            failed++;
+        }
+        for (auto &r : state.results) {
+            if (table) {
+                print_bench_row(r);
+            }
+            all.push_back(r);
+        }
+    }
+    if (opt.format != "table") {
+        std::string report = opt.format == "csv" ? bench_csv(all) : bench_json(all);
+        if (opt.out.empty()) {
+            std::cout << report;
+        }
+        else if (!(std::ofstream(opt.out) << report)) {
+            std::cerr << "cannot write " << opt.out << "\n";
+            return 1;
+        }
+    }
+    return failed > 0 ? 1 : 0;
+}
+} // namespace cp_test
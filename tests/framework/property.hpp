@@ -0,0 +1,252 @@
+// Property testing - seeded random operation sequences run against a structure and a
+// brute-force oracle, shrunk to a minimal failing case on mismatch.
+//
+// How it works:
+//   A case is a size n and a sequence of Ops {kind, l, r, v}; what kind, l, r and v
+//   mean is up to the test (e.g. kind 0 = query(l, r), kind 1 = update(l, r, v)).
+//   check_property(name, gen, run) draws `trials` cases from a seeded generator: n
+//   uniform in [1, max_n], then up to max_ops ops from gen(rng, n). run(case) replays
+//   the case on a fresh structure and a fresh oracle and returns "" if they agree,
+//   otherwise a description of the first mismatch; a thrown exception also counts as
+//   a mismatch.
+//
+// Shrinking: a failing case is reduced greedily, re-running run after each step and
+//   keeping the step only if the case still fails. Steps, repeated until none applies:
+//     - delete chunks of ops, halving the chunk size from n_ops / 2 down to 1
+//     - simplify single ops: v to 0, v halved, the range [l, r] cut to [l, l] or
+//       [r, r] or narrowed by one at either end, then the kind lowered
+//     - shift every index down by one, if none is 0
+//     - lower n to one past the largest index used
+//   Every step keeps 0 <= l <= r < n, so a shrunk case is always valid input provided
+//   run accepts any kind below the original one. The failure reports the seed and the
+//   shrunk case, one op per line.
+//
+// Environment (so CI can run longer and any failure can be replayed):
+//   CP_PROPERTY_SEED=S     base seed instead of the built-in one
+//   CP_PROPERTY_TRIALS=K   trials per property instead of the default
+//
+// Usage:
+//   cp_test::check_property(
+//       "fenwick",
+//       [](cp_test::Rng &rng, long long n) { return random_op(rng, n, 2, 9); },
+//       [](const cp_test::OpCase &c) -> std::string { ...; return ""; });
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace cp_test
+{
+using Rng = std::mt19937_64;
+
+struct Op
+{
+    int kind = 0;
+    long long l = 0, r = 0, v = 0;
+};
+
+struct OpCase
+{
+    long long n = 1;
+    std::vector<Op> ops;
+};
+
+inline std::string to_string(const OpCase &c)
+{
+    std::ostringstream os;
+    os << "n = " << c.n << ", " << c.ops.size() << " ops:";
+    for (size_t i = 0; i < c.ops.size(); i++) {
+        auto &op = c.ops[i];
+        os << "\n  #" << i << " kind " << op.kind << " [" << op.l << ", " << op.r
+           << "] v " << op.v;
+    }
+    return os.str();
+}
+
+struct PropertyOptions
+{
+    uint64_t seed = 0x5eedc0de;
+    int trials = 200;
+    long long max_n = 40;
+    int max_ops = 60;
+};
+
+// Uniform integer in [lo, hi].
+inline long long uniform(Rng &rng, long long lo, long long hi)
+{
+    return std::uniform_int_distribution<long long>(lo, hi)(rng);
+}
+
+// An op with kind in [0, kinds), uniform 0 <= l <= r < n and v in [-vmax, vmax].
+inline Op random_op(Rng &rng, long long n, int kinds, long long vmax)
+{
+    Op op;
+    op.kind = (int)uniform(rng, 0, kinds - 1);
+    op.l = uniform(rng, 0, n - 1);
+    op.r = uniform(rng, 0, n - 1);
+    if (op.l > op.r) {
+        std::swap(op.l, op.r);
+    }
+    op.v = uniform(rng, -vmax, vmax);
+    return op;
+}
+
+// Applies the environment overrides to opt.
+inline PropertyOptions property_options_from_env(PropertyOptions opt = {})
+{
+    if (const char *s = std::getenv("CP_PROPERTY_SEED")) {
+        opt.seed = std::strtoull(s, nullptr, 0);
+    }
+    if (const char *s = std::getenv("CP_PROPERTY_TRIALS")) {
+        opt.trials = std::max(1, std::atoi(s));
+    }
+    return opt;
+}
+
+// Runs run(c), turning an exception into a mismatch message.
+template <typename Run>
+std::string run_case(Run &run, const OpCase &c)
+{
+    try {
+        return run(c);
+    }
+    catch (const std::exception &e) {
+        return std::string("exception: ") + e.what();
+    }
+}
+
+// Greedily shrinks the failing case c (see the header comment) and returns it with the
+// mismatch message of the final case in msg.
+template <typename Run>
+OpCase shrink(Run &run, OpCase c, std::string &msg)
+{
+    auto try_case = [&](const OpCase &cand) {
+        std::string m = run_case(run, cand);
+        if (m.empty()) {
+            return false;
+        }
+        c = cand, msg = m;
+        return true;
+    };
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (size_t chunk = std::max<size_t>(c.ops.size() / 2, 1); chunk >= 1;
+             chunk /= 2) {
+            for (size_t i = 0; i + chunk <= c.ops.size();) {
+                OpCase cand = c;
+                cand.ops.erase(cand.ops.begin() + i, cand.ops.begin() + i + chunk);
+                if (try_case(cand)) {
+                    changed = true;
+                }
+                else {
+                    i += chunk;
+                }
+            }
+        }
+        for (size_t i = 0; i < c.ops.size(); i++) {
+            Op op = c.ops[i];
+            std::vector<Op> simpler;
+            if (op.v != 0) {
+                simpler.push_back({op.kind, op.l, op.r, 0});
+                simpler.push_back({op.kind, op.l, op.r, op.v / 2});
+            }
+            if (op.l < op.r) {
+                simpler.push_back({op.kind, op.l, op.l, op.v});
+                simpler.push_back({op.kind, op.r, op.r, op.v});
+                simpler.push_back({op.kind, op.l + 1, op.r, op.v});
+                simpler.push_back({op.kind, op.l, op.r - 1, op.v});
+            }
+            for (int k = 0; k < op.kind; k++) {
+                simpler.push_back({k, op.l, op.r, op.v});
+            }
+            for (auto &s : simpler) {
+                OpCase cand = c;
+                cand.ops[i] = s;
+                if (try_case(cand)) {
+                    changed = true;
+                    break;
+                }
+            }
+        }
+        bool shiftable = !c.ops.empty();
+        for (auto &op : c.ops) {
+            shiftable &= op.l > 0;
+        }
+        if (shiftable) {
+            OpCase cand = c;
+            for (auto &op : cand.ops) {
+                op.l--, op.r--;
+            }
+            changed |= try_case(cand);
+        }
+        long long used = 0;
+        for (auto &op : c.ops) {
+            used = std::max(used, op.r + 1);
+        }
+        if (used < c.n) {
+            OpCase cand = c;
+            cand.n = used == 0 ? 1 : used;
+            if (cand.n < c.n && try_case(cand)) {
+                changed = true;
+            }
+        }
+    }
+    return c;
+}
+
+// Draws opt.trials random cases and returns false, with the shrunk counterexample in
+// out and its mismatch in msg, on the first one run rejects. Environment overrides are
+// not applied here; check_property applies them.
+template <typename Gen, typename Run>
+bool find_counterexample(Gen &&gen,
+                         Run &&run,
+                         const PropertyOptions &opt,
+                         OpCase &out,
+                         std::string &msg,
+                         uint64_t &trial_seed)
+{
+    for (int t = 0; t < opt.trials; t++) {
+        trial_seed = opt.seed + 0x9e3779b97f4a7c15ULL * (t + 1);
+        Rng rng(trial_seed);
+        OpCase c;
+        c.n = uniform(rng, 1, opt.max_n);
+        int ops = (int)uniform(rng, 1, opt.max_ops);
+        for (int i = 0; i < ops; i++) {
+            c.ops.push_back(gen(rng, c.n));
+        }
+        msg = run_case(run, c);
+        if (!msg.empty()) {
+            out = shrink(run, c, msg);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Throws (failing the enclosing TEST_CASE) with the seed and a shrunk counterexample if
+// any trial fails.
+template <typename Gen, typename Run>
+void check_property(const std::string &name,
+                    Gen &&gen,
+                    Run &&run,
+                    PropertyOptions opt = {})
+{
+    opt = property_options_from_env(opt);
+    OpCase c;
+    std::string msg;
+    uint64_t trial_seed = 0;
+    if (!find_counterexample(gen, run, opt, c, msg, trial_seed)) {
+        std::ostringstream os;
+        os << "property " << name << " failed (CP_PROPERTY_SEED=" << opt.seed
+           << ", trial seed " << trial_seed << "): " << msg << "\nshrunk to "
+           << to_string(c);
+        throw std::runtime_error(os.str());
+    }
+}
+} // namespace cp_test
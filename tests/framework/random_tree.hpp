@@ -0,0 +1,27 @@
+// Random tree generator shared by the tree tests (LCA, HLD, centroid decomposition).
+//
+// Usage:
+//   std::mt19937 rng(38);
+//   cp::CSRGraph<> g(n, cp_test::random_tree(rng, n), false);
+#pragma once
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace cp_test
+{
+// Random tree on n vertices: parent of v is a random earlier vertex (relabelled).
+inline std::vector<std::pair<int, int>> random_tree(std::mt19937 &rng, int n)
+{
+    std::vector<int> label(n);
+    std::iota(label.begin(), label.end(), 0);
+    std::shuffle(label.begin(), label.end(), rng);
+    std::vector<std::pair<int, int>> edges;
+    for (int v = 1; v < n; v++) {
+        edges.push_back({label[rng() % v], label[v]});
+    }
+    return edges;
+}
+} // namespace cp_test
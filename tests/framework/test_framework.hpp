@@ -3,7 +3,7 @@
 // How it works:
 //   TEST_CASE(name) defines a static function and registers it via a static
 //   TestRegistrar, whose constructor runs before main() and pushes the test into a
-//   global registry. test_main.cpp iterates the registry and runs each test, catching
+//   global registry. test_runner.hpp iterates the registry and runs each test, catching
 //   exceptions to report PASS/FAIL.
 //
 // How to add a test:
@@ -0,0 +1,308 @@
+// Test runner - runs the TEST_CASE registry in process or sharded across worker
+// processes, with per-test wall time, a name filter and a timeout.
+//
+// How it works:
+//   In process (the default), every test runs in the runner itself, one after the
+//   other, and a crash or hang takes the whole run down with it.
+//   Isolated (--jobs=N or --timeout=S), the runner forks one child per test and keeps
+//   up to N children alive. The registry is built by static initializers before main(),
+//   so a forked child already holds it and only needs the test's index. The child runs
+//   the test, writes an empty message (pass) or the exception text (fail) to a pipe and
+//   _exits. The parent polls the pipes: end of file means the child is done and
+//   waitpid gives its status; a child that outlives its deadline gets SIGKILL and is
+//   reported as TIMEOUT, so a complexity regression (O(n) per query where O(log n) was
+//   meant) fails one test instead of stalling the suite. A child killed by a signal
+//   (assert, segfault) fails that test only.
+//
+// Runner flags (without --bench):
+//   --filter=S      run only tests whose name contains S
+//   --jobs=N        isolated mode with up to N tests in parallel (0: one per core)
+//   --timeout=S     isolated mode; kill any test running longer than S seconds
+//   --slowest=K     list the K slowest tests after the summary (default 0)
+#pragma once
+#include "test_framework.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <poll.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cp_test
+{
+struct TestOptions
+{
+    std::string filter;
+    int jobs = -1;      // -1: in process; 0: one per core; N: up to N children
+    double timeout = 0; // seconds, 0 for none; implies isolated mode
+    int slowest = 0;
+};
+
+struct TestResult
+{
+    std::string name;
+    bool passed = false;
+    std::string message; // failure reason
+    double ms = 0;       // wall time
+};
+
+namespace runner_detail
+{
+using Clock = std::chrono::steady_clock;
+
+inline double ms_since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Runs one test and returns its failure message, empty on success.
+inline std::string run_one(const TestCase &tc)
+{
+    try {
+        tc.fn();
+        return "";
+    }
+    catch (const std::exception &e) {
+        std::string msg = e.what();
+        return msg.empty() ? "exception" : msg;
+    }
+}
+
+inline void report(const TestResult &r)
+{
+    if (r.passed) {
+        printf("[PASS] %s (%.1f ms)\n", r.name.c_str(), r.ms);
+    }
+    else {
+        printf("[FAIL] %s (%.1f ms): %s\n", r.name.c_str(), r.ms, r.message.c_str());
+    }
+    fflush(stdout);
+}
+
+struct Child
+{
+    pid_t pid;
+    int fd; // read end of the result pipe
+    size_t test;
+    Clock::time_point start;
+    std::string message;
+};
+
+// Waits for a child whose pipe has closed (or that was just killed) and fills r.
+inline void reap(Child &c, TestResult &r, bool timed_out, double timeout)
+{
+    int status = 0;
+    while (waitpid(c.pid, &status, 0) < 0 && errno == EINTR) {
+    }
+    close(c.fd);
+    r.ms = ms_since(c.start);
+    if (timed_out) {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "TIMEOUT after %g s", timeout);
+        r.message = buf;
+    }
+    else if (WIFSIGNALED(status)) {
+        r.message = std::string("killed by signal ") + strsignal(WTERMSIG(status));
+    }
+    else if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        r.message = c.message.empty() ? "exited with status " +
+                                            std::to_string(WEXITSTATUS(status))
+                                      : c.message;
+    }
+    else {
+        r.passed = true;
+    }
+}
+
+inline bool spawn(const std::vector<TestCase> &tests, size_t i, Child &c)
+{
+    int fds[2];
+    if (pipe(fds) < 0) {
+        return false;
+    }
+    fflush(stdout); // or the child would flush the parent's pending output again
+    fflush(stderr);
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        std::string msg = run_one(tests[i]);
+        for (size_t off = 0; off < msg.size();) {
+            ssize_t w = write(fds[1], msg.data() + off, msg.size() - off);
+            if (w <= 0) {
+                break;
+            }
+            off += w;
+        }
+        fflush(stdout);
+        _exit(msg.empty() ? 0 : 1); // skip static destructors shared with the parent
+    }
+    close(fds[1]);
+    c = {pid, fds[0], i, Clock::now(), ""};
+    return true;
+}
+} // namespace runner_detail
+
+// Runs the selected tests in this process. O(total test time).
+inline std::vector<TestResult> run_tests_in_process(const std::vector<size_t> &selected)
+{
+    using namespace runner_detail;
+    auto &tests = Registry();
+    std::vector<TestResult> results;
+    for (size_t i : selected) {
+        TestResult r;
+        r.name = tests[i].name;
+        auto start = Clock::now();
+        r.message = run_one(tests[i]);
+        r.ms = ms_since(start);
+        r.passed = r.message.empty();
+        report(r);
+        results.push_back(r);
+    }
+    return results;
+}
+
+// Runs the selected tests one child process each, up to jobs at a time, and reports
+// each as it finishes; results are returned in registry order.
+inline std::vector<TestResult> run_tests_isolated(const std::vector<size_t> &selected,
+                                                  int jobs,
+                                                  double timeout)
+{
+    using namespace runner_detail;
+    auto &tests = Registry();
+    if (jobs <= 0) {
+        jobs = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::vector<TestResult> results(selected.size());
+    std::vector<int> slot(tests.size(), -1); // registry index -> results index
+    for (size_t k = 0; k < selected.size(); k++) {
+        results[k].name = tests[selected[k]].name;
+        slot[selected[k]] = k;
+    }
+    auto deadline = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(timeout));
+    std::vector<Child> running;
+    size_t next = 0;
+    while (next < selected.size() || !running.empty()) {
+        while (next < selected.size() && (int)running.size() < jobs) {
+            Child c;
+            if (!spawn(tests, selected[next], c)) {
+                results[next].message = std::string("cannot fork: ") + strerror(errno);
+                report(results[next]);
+            }
+            else {
+                running.push_back(c);
+            }
+            next++;
+        }
+        if (running.empty()) {
+            continue;
+        }
+        // Sleep until some pipe has data or closes, or the earliest deadline passes.
+        int wait_ms = -1;
+        if (timeout > 0) {
+            auto now = Clock::now();
+            Clock::duration left = Clock::duration::max();
+            for (auto &c : running) {
+                left = std::min(left, c.start + deadline - now);
+            }
+            auto ms = std::chrono::ceil<std::chrono::milliseconds>(left).count();
+            wait_ms = (int)std::clamp<long long>(ms, 0, 1 << 30);
+        }
+        std::vector<pollfd> pfds;
+        for (auto &c : running) {
+            pfds.push_back({c.fd, POLLIN, 0});
+        }
+        if (poll(pfds.data(), pfds.size(), wait_ms) < 0 && errno != EINTR) {
+            perror("poll");
+            break;
+        }
+        std::vector<Child> still;
+        for (size_t k = 0; k < running.size(); k++) {
+            Child &c = running[k];
+            TestResult &r = results[slot[c.test]];
+            bool done = false;
+            if (pfds[k].revents & (POLLIN | POLLHUP | POLLERR)) {
+                char buf[4096];
+                ssize_t got = read(c.fd, buf, sizeof(buf));
+                if (got > 0) {
+                    c.message.append(buf, got);
+                }
+                else if (got == 0 || errno != EINTR) {
+                    reap(c, r, false, timeout);
+                    done = true;
+                }
+            }
+            if (!done && timeout > 0 && Clock::now() - c.start >= deadline) {
+                kill(c.pid, SIGKILL);
+                reap(c, r, true, timeout);
+                done = true;
+            }
+            if (done) {
+                report(r);
+            }
+            else {
+                still.push_back(c);
+            }
+        }
+        running = std::move(still);
+    }
+    return results;
+}
+
+// Runs every registered test whose name contains opt.filter and prints a summary.
+// Returns the process exit code: nonzero if any selected test failed.
+inline int run_tests(const TestOptions &opt)
+{
+    auto &tests = Registry();
+    std::vector<size_t> selected;
+    for (size_t i = 0; i < tests.size(); i++) {
+        if (tests[i].name.find(opt.filter) != std::string::npos) {
+            selected.push_back(i);
+        }
+    }
+    auto start = runner_detail::Clock::now();
+    bool isolated = opt.jobs >= 0 || opt.timeout > 0;
+    std::vector<TestResult> results =
+        isolated ? run_tests_isolated(selected, std::max(opt.jobs, 0), opt.timeout)
+                 : run_tests_in_process(selected);
+    double wall = runner_detail::ms_since(start);
+
+    int passed = 0;
+    std::vector<const TestResult *> failed;
+    for (auto &r : results) {
+        r.passed ? (void)passed++ : failed.push_back(&r);
+    }
+    printf("\n%d/%zu tests passed in %.1f ms.\n", passed, results.size(), wall);
+    if (isolated && !failed.empty()) { // finish order scatters them; repeat at the end
+        printf("Failed:\n");
+        for (auto *r : failed) {
+            printf("  %s: %s\n", r->name.c_str(), r->message.c_str());
+        }
+    }
+    if (opt.slowest > 0) {
+        std::vector<const TestResult *> order;
+        for (auto &r : results) {
+            order.push_back(&r);
+        }
+        size_t k = std::min<size_t>(opt.slowest, order.size());
+        std::partial_sort(order.begin(),
+                          order.begin() + k,
+                          order.end(),
+                          [](auto *a, auto *b) { return a->ms > b->ms; });
+        printf("Slowest %zu:\n", k);
+        for (size_t i = 0; i < k; i++) {
+            printf("  %10.1f ms  %s\n", order[i]->ms, order[i]->name.c_str());
+        }
+    }
+    fflush(stdout);
+    return failed.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+} // namespace cp_test
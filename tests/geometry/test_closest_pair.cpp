@@ -0,0 +1,79 @@
+#include "../framework/test_framework.hpp"
+#include "cp/geometry/closest_pair.hpp"
+
+static cp::i128 brute_closest(const std::vector<cp::Point> &a)
+{
+    cp::i128 best = -1;
+    for (size_t i = 0; i < a.size(); i++) {
+        for (size_t j = i + 1; j < a.size(); j++) {
+            cp::i128 d = cp::norm2(a[i] - a[j]);
+            if (best < 0 || d < best) {
+                best = d;
+            }
+        }
+    }
+    return best;
+}
+
+static void check_closest(const std::vector<cp::Point> &a)
+{
+    cp::ClosestPair res((cp::Points(a)));
+    EXPECT_TRUE(res.dist2 == brute_closest(a));
+    EXPECT_TRUE(res.i >= 0 && res.i < res.j && res.j < (int)a.size());
+    EXPECT_TRUE(cp::norm2(a[res.i] - a[res.j]) == res.dist2);
+}
+
+TEST_CASE(closest_pair_matches_brute_force)
+{
+    std::mt19937 rng(39);
+    for (int it = 0; it < 500; it++) {
+        int n = 2 + rng() % 60, range = 1 + rng() % 1000;
+        std::vector<cp::Point> a;
+        for (int i = 0; i < n; i++) {
+            a.push_back({(cp::ll)(rng() % (2 * range + 1)) - range,
+                         (cp::ll)(rng() % (2 * range + 1)) - range});
+        }
+        check_closest(a);
+    }
+}
+
+TEST_CASE(closest_pair_degenerate_inputs)
+{
+    check_closest({{0, 0}, {3, 4}});
+    check_closest({{7, 7}, {1, 1}, {7, 7}}); // duplicate
+    std::vector<cp::Point> line, column;
+    for (int i = 0; i < 100; i++) {
+        line.push_back({3 * i * i, 0}); // collinear, gaps grow
+        column.push_back({5, 100 - 2 * i});
+    }
+    check_closest(line);
+    check_closest(column);
+}
+
+TEST_CASE(closest_pair_large_coordinates)
+{
+    std::mt19937_64 rng(40);
+    cp::ll big = 1000000000000000000LL;
+    std::uniform_int_distribution<cp::ll> coord(-big, big);
+    for (int it = 0; it < 50; it++) {
+        std::vector<cp::Point> a;
+        for (int i = 0; i < 40; i++) {
+            a.push_back({coord(rng), coord(rng)});
+        }
+        check_closest(a);
+    }
+    check_closest({{-big, -big}, {big, big}}); // squared distance 8e36, fits cp::i128
+}
+
+TEST_CASE(closest_pair_many_points)
+{
+    std::mt19937 rng(41);
+    std::vector<cp::Point> a;
+    for (int i = 0; i < 200000; i++) {
+        a.push_back({(cp::ll)(rng() % 1000000000), (cp::ll)(rng() % 1000000000)});
+    }
+    a.push_back({a[123].x + 1, a[123].y}); // forced pair at distance 1
+    cp::ClosestPair res((cp::Points(a)));
+    EXPECT_TRUE(res.dist2 <= 1);
+    EXPECT_TRUE(cp::norm2(a[res.i] - a[res.j]) == res.dist2);
+}
@@ -0,0 +1,168 @@
+#include "../framework/test_framework.hpp"
+#include "cp/geometry/convex_hull.hpp"
+
+// Hull vertices by brute force: endpoints of every segment p -> q that has all points
+// on its left or strictly between p and q.
+static std::set<std::pair<cp::ll, cp::ll>> brute_hull(const std::vector<cp::Point> &a)
+{
+    std::set<std::pair<cp::ll, cp::ll>> distinct;
+    for (auto p : a) {
+        distinct.insert({p.x, p.y});
+    }
+    std::vector<cp::Point> d;
+    for (auto [x, y] : distinct) {
+        d.push_back({x, y});
+    }
+    std::set<std::pair<cp::ll, cp::ll>> res;
+    if (d.size() <= 2) {
+        return distinct;
+    }
+    for (auto p : d) {
+        for (auto q : d) {
+            if (p == q) {
+                continue;
+            }
+            bool ok = true;
+            for (auto r : d) {
+                cp::i128 c = cp::cross(p, q, r);
+                if (c < 0) {
+                    ok = false;
+                }
+                else if (c == 0 && !(r == p) && !(r == q)) {
+                    // collinear r must lie between p and q
+                    ok &= cp::dot(r - p, q - p) > 0 && cp::dot(r - q, p - q) > 0;
+                }
+            }
+            if (ok) {
+                res.insert({p.x, p.y});
+                res.insert({q.x, q.y});
+            }
+        }
+    }
+    return res;
+}
+
+static void check_hull(const std::vector<cp::Point> &a)
+{
+    cp::Points h = cp::convex_hull(cp::Points(a));
+    std::set<std::pair<cp::ll, cp::ll>> got;
+    for (size_t i = 0; i < h.size(); i++) {
+        got.insert({h.xs[i], h.ys[i]});
+    }
+    EXPECT_EQ(got.size(), h.size());
+    EXPECT_TRUE(got == brute_hull(a));
+    if (h.size() >= 3) {
+        for (size_t i = 0; i < h.size(); i++) { // strictly counter-clockwise
+            size_t j = (i + 1) % h.size(), k = (i + 2) % h.size();
+            EXPECT_EQ(cp::orientation(h[i], h[j], h[k]), 1);
+        }
+    }
+    for (size_t i = 1; i < h.size(); i++) { // starts at the smallest point
+        EXPECT_TRUE(h[0] < h[i]);
+    }
+}
+
+TEST_CASE(convex_hull_matches_brute_force)
+{
+    std::mt19937 rng(39);
+    for (int it = 0; it < 400; it++) {
+        int n = 1 + rng() % 25, range = 1 + rng() % 8;
+        std::vector<cp::Point> a;
+        for (int i = 0; i < n; i++) {
+            a.push_back({(cp::ll)(rng() % (2 * range + 1)) - range,
+                         (cp::ll)(rng() % (2 * range + 1)) - range});
+        }
+        check_hull(a);
+    }
+}
+
+TEST_CASE(convex_hull_degenerate_inputs)
+{
+    EXPECT_EQ(cp::convex_hull(cp::Points()).size(), 0u);
+    check_hull({{5, 5}});
+    check_hull({{5, 5}, {5, 5}, {5, 5}});
+    check_hull({{0, 0}, {1, 1}, {2, 2}, {3, 3}, {1, 1}}); // collinear
+    check_hull({{0, 0}, {0, 3}, {0, 1}});                 // vertical
+    check_hull({{0, 0}, {4, 0}, {4, 4}, {0, 4}, {2, 0}, {4, 2}, {2, 2}});
+    cp::Points h = cp::convex_hull(cp::Points(std::vector<cp::Point>{{3, 3}, {1, 1}}));
+    EXPECT_EQ(h.size(), 2u);
+    EXPECT_TRUE(h[0] == (cp::Point{1, 1}));
+}
+
+TEST_CASE(convex_hull_large_coordinates)
+{
+    std::mt19937_64 rng(40);
+    cp::ll big = 1000000000000000000LL;
+    std::uniform_int_distribution<cp::ll> coord(-big, big);
+    for (int it = 0; it < 50; it++) {
+        std::vector<cp::Point> a;
+        for (int i = 0; i < 20; i++) {
+            a.push_back({coord(rng), coord(rng)});
+        }
+        a.push_back({big, big});
+        a.push_back({big - 1, big}); // nearly collinear with neighbours
+        check_hull(a);
+    }
+}
+
+TEST_CASE(convex_hull_many_points_keeps_circle)
+{
+    // lattice points on a circle are all hull vertices; random interior points are not
+    std::vector<cp::Point> a;
+    int r = 5525; // 5525^2 has many representations as a sum of two squares
+    for (cp::ll x = -r; x <= r; x++) {
+        cp::ll y2 = (cp::ll)r * r - x * x, y = llroundl(sqrtl((long double)y2));
+        if (y * y == y2) {
+            a.push_back({x, y});
+            a.push_back({x, -y});
+        }
+    }
+    std::set<std::pair<cp::ll, cp::ll>> circle;
+    for (auto p : a) {
+        circle.insert({p.x, p.y});
+    }
+    std::mt19937 rng(41);
+    for (int i = 0; i < 200000; i++) {
+        a.push_back({(cp::ll)(rng() % 7000) - 3500, (cp::ll)(rng() % 7000) - 3500});
+    }
+    cp::Points h = cp::convex_hull(cp::Points(a));
+    EXPECT_EQ(h.size(), circle.size());
+    for (size_t i = 0; i < h.size(); i++) {
+        EXPECT_TRUE(circle.count({h.xs[i], h.ys[i]}));
+    }
+}
+
+TEST_CASE(convex_hull_diameter_and_width)
+{
+    std::mt19937 rng(42);
+    for (int it = 0; it < 300; it++) {
+        int n = 1 + rng() % 30;
+        std::vector<cp::Point> a;
+        for (int i = 0; i < n; i++) {
+            a.push_back({(cp::ll)(rng() % 41) - 20, (cp::ll)(rng() % 41) - 20});
+        }
+        cp::i128 best = 0;
+        for (auto p : a) {
+            for (auto q : a) {
+                best = std::max(best, cp::norm2(p - q));
+            }
+        }
+        cp::Points h = cp::convex_hull(cp::Points(a));
+        EXPECT_TRUE(cp::hull_diameter2(h) == best);
+        // width: min over hull edges of the farthest hull point from the edge line
+        long double width = h.size() <= 2 ? 0 : 1e30L;
+        for (size_t i = 0; i < h.size() && h.size() > 2; i++) {
+            cp::Point p = h[i], q = h[(i + 1) % h.size()];
+            long double far = 0;
+            for (size_t k = 0; k < h.size(); k++) {
+                far = std::max(far, (long double)cp::cross(p, q, h[k]));
+            }
+            width = std::min(width, far / sqrtl((long double)cp::norm2(q - p)));
+        }
+        EXPECT_NEAR(cp::hull_width(h), width, 1e-9L);
+    }
+    cp::Points square = cp::convex_hull(
+        cp::Points(std::vector<cp::Point>{{0, 0}, {10, 0}, {10, 3}, {0, 3}}));
+    EXPECT_TRUE(cp::hull_diameter2(square) == 109);
+    EXPECT_NEAR(cp::hull_width(square), 3.0L, 1e-12L);
+}
@@ -0,0 +1,60 @@
+#include "../framework/test_framework.hpp"
+#include "cp/geometry/point.hpp"
+
+TEST_CASE(point_cross_dot_and_orientation)
+{
+    cp::Point o{1, 1}, a{4, 1}, b{1, 3};
+    EXPECT_TRUE(cp::cross(o, a, b) == 6);
+    EXPECT_TRUE(cp::dot(a - o, b - o) == 0);
+    EXPECT_EQ(cp::orientation(o, a, b), 1);
+    EXPECT_EQ(cp::orientation(o, b, a), -1);
+    EXPECT_EQ(cp::orientation(o, a, cp::Point{7, 1}), 0);
+    EXPECT_TRUE(a.perp() == (cp::Point{-1, 4}));
+    EXPECT_TRUE(cp::norm2(cp::Point{3, 4}) == 25);
+    EXPECT_TRUE((cp::Point{1, 5} < cp::Point{2, 0}));
+    EXPECT_TRUE((cp::Point{1, 0} < cp::Point{1, 5}));
+}
+
+TEST_CASE(point_cross_is_exact_at_large_coordinates)
+{
+    cp::ll big = 1000000000000000000LL; // 1e18: products overflow cp::ll, not cp::i128
+    cp::Point o{-big, -big}, a{big, -big + 1}, b{big, -big + 2};
+    // (2e18, 1) x (2e18, 2) = 4e18 - 2e18 = 2e18
+    EXPECT_TRUE(cp::cross(o, a, b) == (cp::i128)2 * big);
+    EXPECT_EQ(cp::orientation(o, a, b), 1);
+    EXPECT_EQ(cp::orientation(o, a, cp::Point{big - 1, -big + 1}), 1);
+}
+
+TEST_CASE(point_soa_storage)
+{
+    std::vector<cp::Point> a = {{1, 2}, {3, 4}, {-5, 6}};
+    cp::Points p(a);
+    EXPECT_EQ(p.size(), 3u);
+    EXPECT_TRUE(p[2] == a[2]);
+    EXPECT_EQ(p.xs[1], 3);
+    EXPECT_EQ(p.ys[1], 4);
+    p.push_back({7, 8});
+    EXPECT_TRUE(p[3] == (cp::Point{7, 8}));
+    cp::Points z(5);
+    EXPECT_TRUE(z[4] == (cp::Point{0, 0}));
+}
+
+TEST_CASE(point_orientations_match_scalar_on_both_paths)
+{
+    std::mt19937_64 rng(39);
+    for (cp::ll range : {1000LL, 1000000000000000000LL}) {
+        std::uniform_int_distribution<cp::ll> coord(-range, range);
+        cp::Points p;
+        for (int i = 0; i < 1000; i++) {
+            p.push_back({coord(rng), coord(rng)});
+        }
+        p.push_back({0, 0});
+        cp::Point a{coord(rng), coord(rng)}, b{coord(rng), coord(rng)};
+        p.push_back(a + (b - a) * 2); // collinear
+        std::vector<int8_t> out(p.size());
+        cp::orientations(p, a, b, out);
+        for (size_t i = 0; i < p.size(); i++) {
+            EXPECT_EQ(out[i], cp::orientation(a, b, p[i]));
+        }
+    }
+}
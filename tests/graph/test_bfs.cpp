@@ -0,0 +1,109 @@
+#include "../framework/test_framework.hpp"
+#include "cp/graph/bfs.hpp"
+
+static std::vector<int> naive_bfs(const cp::CSRGraph<> &g, int s)
+{
+    std::vector<int> d(g.n, -1), q = {s};
+    d[s] = 0;
+    for (size_t i = 0; i < q.size(); i++) {
+        for (int to : g.neighbors(q[i])) {
+            if (d[to] == -1) {
+                d[to] = d[q[i]] + 1;
+                q.push_back(to);
+            }
+        }
+    }
+    return d;
+}
+
+// dist matches the reference and parent[v] is an in-neighbor one level closer.
+static void check(const cp::CSRGraph<> &g, int s, int threads, bool directed)
+{
+    cp::CSRGraph<> r = g.reversed();
+    std::vector<int> dist(g.n), parent(g.n);
+    int reached = cp::bfs(g, s, dist, parent, threads, directed ? &r : nullptr);
+    auto expected = naive_bfs(g, s);
+    EXPECT_EQ(dist, expected);
+    EXPECT_EQ(reached, (int)std::count_if(dist.begin(), dist.end(), [](int d) {
+                  return d != -1;
+              }));
+    EXPECT_EQ(parent[s], -1);
+    for (int v = 0; v < g.n; v++) {
+        if (v == s || dist[v] == -1) {
+            EXPECT_EQ(parent[v], -1);
+            continue;
+        }
+        int p = parent[v];
+        EXPECT_EQ(dist[p], dist[v] - 1);
+        auto nb = g.neighbors(p);
+        EXPECT_TRUE(std::find(nb.begin(), nb.end(), v) != nb.end());
+    }
+}
+
+static std::vector<std::pair<int, int>> random_edges(std::mt19937 &rng, int n, int m)
+{
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < m; i++) {
+        edges.push_back({(int)(rng() % n), (int)(rng() % n)});
+    }
+    return edges;
+}
+
+TEST_CASE(bfs_matches_naive_undirected)
+{
+    std::mt19937 rng(35);
+    for (int n : {1, 2, 63, 64, 65, 1000, 100000}) {
+        for (int deg : {1, 2, 16}) { // sparse: mostly top-down; dense: bottom-up
+            cp::CSRGraph<> g(n, random_edges(rng, n, n * deg / 2), false);
+            for (int threads : {1, 4}) {
+                check(g, rng() % n, threads, false);
+            }
+        }
+    }
+}
+
+TEST_CASE(bfs_matches_naive_directed)
+{
+    std::mt19937 rng(36);
+    for (int n : {10, 1000, 100000}) {
+        for (int deg : {1, 3, 20}) {
+            cp::CSRGraph<> g(n, random_edges(rng, n, n * deg));
+            for (int threads : {1, 4}) {
+                check(g, rng() % n, threads, true);
+            }
+        }
+    }
+}
+
+TEST_CASE(bfs_dense_and_deep)
+{
+    // complete graph: level 1 already goes bottom-up
+    int n = 300;
+    std::vector<std::pair<int, int>> complete, chain;
+    for (int u = 0; u < n; u++) {
+        for (int v = u + 1; v < n; v++) {
+            complete.push_back({u, v});
+        }
+    }
+    check(cp::CSRGraph<>(n, complete, false), 5, 4, false);
+    // a long chain: one vertex per level
+    n = 1000000;
+    for (int v = 1; v < n; v++) {
+        chain.push_back({v - 1, v});
+    }
+    cp::CSRGraph<> g(n, chain, false);
+    std::vector<int> dist(n);
+    EXPECT_EQ((cp::bfs(g, 0, dist, {}, 4)), n);
+    EXPECT_EQ(dist[n - 1], n - 1);
+}
+
+TEST_CASE(bfs_assertions)
+{
+    cp::CSRGraph<> g(3, {{0, 1}, {1, 2}});
+    std::vector<int> dist(3), small(2);
+    EXPECT_ABORT((cp::bfs(g, 3, dist)));
+    EXPECT_ABORT((cp::bfs(g, 0, small)));
+    EXPECT_ABORT((cp::bfs(g, 0, dist, small)));
+    cp::CSRGraph<> other(4);
+    EXPECT_ABORT((cp::bfs(g, 0, dist, {}, 1, &other)));
+}
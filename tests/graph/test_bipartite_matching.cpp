@@ -0,0 +1,98 @@
+#include "../framework/test_framework.hpp"
+#include "cp/graph/bipartite_matching.hpp"
+
+using Edges = std::vector<std::pair<int, int>>;
+
+// Kuhn's algorithm.
+static int naive_matching(int left, int right, const Edges &edges)
+{
+    std::vector<std::vector<int>> adj(left);
+    for (auto [l, r] : edges) {
+        adj[l].push_back(r);
+    }
+    std::vector<int> mr(right, -1);
+    std::vector<char> used;
+    std::function<bool(int)> go = [&](int l) {
+        for (int r : adj[l]) {
+            if (!used[r]) {
+                used[r] = 1;
+                if (mr[r] == -1 || go(mr[r])) {
+                    mr[r] = l;
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+    int res = 0;
+    for (int l = 0; l < left; l++) {
+        used.assign(right, 0);
+        res += go(l);
+    }
+    return res;
+}
+
+TEST_CASE(hopcroft_karp_matches_kuhn)
+{
+    std::mt19937 rng(37);
+    for (int it = 0; it < 300; it++) {
+        int left = 1 + rng() % 15, right = 1 + rng() % 15, m = rng() % 50;
+        cp::HopcroftKarp hk(left, right);
+        Edges edges;
+        for (int i = 0; i < m; i++) {
+            int l = rng() % left, r = rng() % right;
+            edges.push_back({l, r});
+            hk.add_edge(l, r);
+        }
+        int size = hk.max_matching();
+        EXPECT_EQ(size, naive_matching(left, right, edges));
+        int matched = 0;
+        for (int l = 0; l < left; l++) {
+            int r = hk.match_left[l];
+            if (r == -1) {
+                continue;
+            }
+            matched++;
+            EXPECT_EQ(hk.match_right[r], l);
+            EXPECT_TRUE(std::find(edges.begin(), edges.end(), std::pair{l, r}) !=
+                        edges.end());
+        }
+        EXPECT_EQ(matched, size);
+    }
+}
+
+TEST_CASE(hopcroft_karp_long_alternating_paths)
+{
+    // left i - right i and right i + 1; adding the edges in an order where greedy
+    // choices force long augmenting paths
+    int n = 1000000;
+    cp::HopcroftKarp hk(n, n);
+    for (int i = 0; i < n; i++) {
+        if (i + 1 < n) {
+            hk.add_edge(i, i + 1);
+        }
+        hk.add_edge(i, i);
+    }
+    EXPECT_EQ(hk.max_matching(), n);
+    for (int i = 0; i < n; i++) {
+        EXPECT_EQ(hk.match_left[i], i);
+    }
+}
+
+TEST_CASE(hopcroft_karp_incremental)
+{
+    cp::HopcroftKarp hk(2, 2);
+    hk.add_edge(0, 0);
+    hk.add_edge(1, 0);
+    EXPECT_EQ(hk.max_matching(), 1);
+    hk.add_edge(1, 1);
+    EXPECT_EQ(hk.max_matching(), 2);
+}
+
+TEST_CASE(hopcroft_karp_assertions)
+{
+    cp::HopcroftKarp hk(2, 3);
+    EXPECT_ABORT(hk.add_edge(2, 0));
+    EXPECT_ABORT(hk.add_edge(0, 3));
+    EXPECT_ABORT(hk.add_edge(-1, 0));
+}
@@ -0,0 +1,126 @@
+#include "../framework/random_tree.hpp"
+#include "../framework/test_framework.hpp"
+#include "cp/graph/centroid_decomposition.hpp"
+
+static std::vector<int> bfs_dist(const cp::CSRGraph<> &g, int s)
+{
+    std::vector<int> d(g.n, -1), q = {s};
+    d[s] = 0;
+    for (size_t i = 0; i < q.size(); i++) {
+        for (int to : g.neighbors(q[i])) {
+            if (d[to] == -1) {
+                d[to] = d[q[i]] + 1;
+                q.push_back(to);
+            }
+        }
+    }
+    return d;
+}
+
+TEST_CASE(centroid_decomposition_structure)
+{
+    std::mt19937 rng(38);
+    for (int n : {1, 2, 3, 10, 257, 1000}) {
+        cp::CSRGraph<> g(n, cp_test::random_tree(rng, n), false);
+        cp::CentroidDecomposition cd(g);
+        EXPECT_TRUE(cd.levels <= (int)std::bit_width((unsigned)n));
+        std::vector<int> count(cd.levels, 0);
+        for (int v = 0; v < n; v++) {
+            count[cd.level[v]]++;
+            if (cd.parent[v] != -1) {
+                EXPECT_EQ(cd.level[cd.parent[v]], cd.level[v] - 1);
+                EXPECT_TRUE(2 * cd.comp_size[v] <= cd.comp_size[cd.parent[v]]);
+            }
+            else {
+                EXPECT_EQ(cd.comp_size[v], n);
+            }
+            // v's ancestors' component ranges all contain v's slot at their level
+            cd.for_each_ancestor(v, [&](int c, int L, int, int slot) {
+                auto [l, r] = cd.component_range(c);
+                EXPECT_EQ(L, cd.level[c]);
+                EXPECT_TRUE(l <= slot && slot <= r && r < cd.level_size[L]);
+            });
+        }
+        EXPECT_EQ(count[0], 1);
+    }
+}
+
+TEST_CASE(centroid_decomposition_distances)
+{
+    std::mt19937 rng(39);
+    int n = 500;
+    cp::CSRGraph<> g(n, cp_test::random_tree(rng, n), false);
+    cp::CentroidDecomposition cd(g);
+    for (int u = 0; u < n; u++) {
+        auto d = bfs_dist(g, u);
+        for (int v = 0; v < n; v++) {
+            EXPECT_EQ(cd.dist(u, v), d[v]);
+        }
+        cd.for_each_ancestor(u, [&](int c, int, int dc, int) { EXPECT_EQ(dc, d[c]); });
+    }
+}
+
+TEST_CASE(nearest_marked_matches_brute_force)
+{
+    std::mt19937 rng(40);
+    int n = 300;
+    cp::CSRGraph<> g(n, cp_test::random_tree(rng, n), false);
+    cp::CentroidDecomposition cd(g);
+    cp::NearestMarked nm(cd);
+    std::vector<std::vector<int>> d(n);
+    for (int v = 0; v < n; v++) {
+        d[v] = bfs_dist(g, v);
+    }
+    std::vector<char> marked(n, 0);
+    for (int it = 0; it < 3000; it++) {
+        int v = rng() % n;
+        int op = rng() % 3;
+        if (op == 0) {
+            nm.mark(v);
+            marked[v] = 1;
+        }
+        else if (op == 1) {
+            nm.unmark(v);
+            marked[v] = 0;
+        }
+        else {
+            int expected = cp::INF;
+            for (int u = 0; u < n; u++) {
+                if (marked[u]) {
+                    expected = std::min(expected, d[v][u]);
+                }
+            }
+            EXPECT_EQ(nm.query(v), expected);
+        }
+    }
+}
+
+TEST_CASE(centroid_decomposition_long_path)
+{
+    int n = 1000000;
+    std::vector<std::pair<int, int>> path;
+    for (int v = 1; v < n; v++) {
+        path.push_back({v - 1, v});
+    }
+    cp::CentroidDecomposition cd(cp::CSRGraph<>(n, path, false));
+    EXPECT_TRUE(cd.levels <= 20);
+    EXPECT_EQ(cd.dist(0, n - 1), n - 1);
+    EXPECT_EQ(cd.dist(12345, 54321), 54321 - 12345);
+    cp::NearestMarked nm(cd);
+    nm.mark(777777);
+    EXPECT_EQ(nm.query(0), 777777);
+    nm.mark(10);
+    EXPECT_EQ(nm.query(0), 10);
+    nm.unmark(10);
+    EXPECT_EQ(nm.query(777770), 7);
+}
+
+TEST_CASE(centroid_decomposition_assertions)
+{
+    cp::CSRGraph<> forest(4, {{0, 1}, {2, 3}}, false);
+    EXPECT_ABORT((cp::CentroidDecomposition(forest)));
+    cp::CSRGraph<> g(3, {{0, 1}, {1, 2}}, false);
+    cp::CentroidDecomposition cd(g);
+    EXPECT_ABORT(cd.dist(0, 3));
+    EXPECT_ABORT(cd.dist_to_ancestor(0, cd.level[0] + 1));
+}
@@ -0,0 +1,83 @@
+#include "../framework/test_framework.hpp"
+#include "cp/graph/csr_graph.hpp"
+
+static std::vector<int> to_vec(std::span<const int> s)
+{
+    return std::vector<int>(s.begin(), s.end());
+}
+
+TEST_CASE(csr_graph_directed)
+{
+    std::vector<std::pair<int, int>> edges = {{0, 1}, {2, 0}, {0, 3}, {1, 2}, {0, 2}};
+    cp::CSRGraph<> g(4, edges);
+    EXPECT_EQ(g.num_vertices(), 4);
+    EXPECT_EQ(g.num_edges(), 5);
+    EXPECT_FALSE(g.weighted());
+    EXPECT_EQ(to_vec(g.neighbors(0)), (std::vector<int>{1, 3, 2})); // input order
+    EXPECT_EQ(to_vec(g.neighbors(1)), (std::vector<int>{2}));
+    EXPECT_EQ(to_vec(g.neighbors(2)), (std::vector<int>{0}));
+    EXPECT_TRUE(g.neighbors(3).empty());
+    EXPECT_EQ(g.offsets, (std::vector<int>{0, 3, 4, 5, 5}));
+}
+
+TEST_CASE(csr_graph_undirected)
+{
+    std::vector<std::pair<int, int>> edges = {{0, 1}, {1, 2}, {2, 2}};
+    cp::CSRGraph<> g(3, edges, false);
+    EXPECT_EQ(g.num_edges(), 6);
+    EXPECT_EQ(to_vec(g.neighbors(0)), (std::vector<int>{1}));
+    EXPECT_EQ(to_vec(g.neighbors(1)), (std::vector<int>{0, 2}));
+    EXPECT_EQ(to_vec(g.neighbors(2)), (std::vector<int>{1, 2, 2})); // self-loop twice
+}
+
+TEST_CASE(csr_graph_weighted)
+{
+    std::vector<std::tuple<int, int, cp::ll>> edges = {{0, 1, 5}, {1, 0, 7}, {0, 2, 9}};
+    cp::CSRGraph<int, cp::ll> g(3, edges);
+    EXPECT_TRUE(g.weighted());
+    auto w = g.edge_weights(0);
+    EXPECT_EQ(std::vector<cp::ll>(w.begin(), w.end()), (std::vector<cp::ll>{5, 9}));
+    cp::ll total = 0;
+    for (int e = g.offsets[1]; e < g.offsets[2]; e++) {
+        EXPECT_EQ(g.targets[e], 0);
+        total += g.weights[e];
+    }
+    EXPECT_EQ(total, 7LL);
+}
+
+TEST_CASE(csr_graph_long_indices)
+{
+    std::vector<std::pair<cp::ll, cp::ll>> edges = {{0, 2}, {2, 1}};
+    cp::CSRGraph<cp::ll> g(3, edges, false);
+    EXPECT_EQ(g.num_edges(), 4LL);
+    EXPECT_EQ(g.degree(2), 2LL);
+    EXPECT_EQ(g.neighbors(2)[1], 1LL);
+}
+
+TEST_CASE(csr_graph_reversed)
+{
+    std::vector<std::tuple<int, int, int>> edges = {{0, 1, 1}, {0, 2, 2}, {1, 2, 3}};
+    cp::CSRGraph<int, int> g(3, edges);
+    auto r = g.reversed();
+    EXPECT_EQ(r.num_edges(), 3);
+    EXPECT_EQ(to_vec(r.neighbors(2)), (std::vector<int>{0, 1}));
+    auto w = r.edge_weights(2);
+    EXPECT_EQ(std::vector<int>(w.begin(), w.end()), (std::vector<int>{2, 3}));
+    EXPECT_TRUE(r.neighbors(0).empty());
+}
+
+TEST_CASE(csr_graph_empty)
+{
+    cp::CSRGraph<> g(3);
+    EXPECT_EQ(g.num_edges(), 0);
+    EXPECT_TRUE(g.neighbors(1).empty());
+}
+
+TEST_CASE(csr_graph_assertions)
+{
+    std::vector<std::pair<int, int>> bad = {{0, 3}};
+    EXPECT_ABORT(cp::CSRGraph<>(3, bad));
+    cp::CSRGraph<> g(3);
+    EXPECT_ABORT(g.neighbors(3));
+    EXPECT_ABORT(g.edge_weights(0)); // unweighted
+}
@@ -0,0 +1,172 @@
+#include "../framework/test_framework.hpp"
+#include "cp/graph/dijkstra.hpp"
+
+using Edges = std::vector<std::tuple<int, int, cp::ll>>;
+
+static Edges random_edges(std::mt19937 &rng, int n, int m, int max_w)
+{
+    Edges edges;
+    for (int i = 0; i < m; i++) {
+        int u = rng() % n, v = rng() % n;
+        edges.push_back({u, v, (cp::ll)(rng() % (max_w + 1))});
+    }
+    return edges;
+}
+
+// Bellman-Ford distances from s, -1 if unreachable.
+static std::vector<cp::ll> naive_dist(int n, const Edges &edges, int s)
+{
+    std::vector<cp::ll> d(n, -1);
+    d[s] = 0;
+    for (int it = 0; it < n; it++) {
+        for (auto [u, v, w] : edges) {
+            if (d[u] != -1 && (d[v] == -1 || d[u] + w < d[v])) {
+                d[v] = d[u] + w;
+            }
+        }
+    }
+    return d;
+}
+
+template <typename Heap>
+static void check_random_graphs()
+{
+    std::mt19937 rng(34);
+    for (int n : {1, 2, 10, 200}) {
+        Edges edges = random_edges(rng, n, 3 * n, rng() % 2 ? 5 : 1000000);
+        cp::CSRGraph<int, cp::ll> g(n, edges);
+        cp::Dijkstra<Heap> sp(g);
+        for (int s = 0; s < std::min(n, 20); s++) { // the same engine for every source
+            sp.run(s);
+            auto expected = naive_dist(n, edges, s);
+            for (int v = 0; v < n; v++) {
+                if (expected[v] == -1) {
+                    EXPECT_EQ(sp.dist[v], sp.UNREACHED);
+                    EXPECT_TRUE(sp.path(v).empty());
+                    continue;
+                }
+                EXPECT_EQ(sp.dist[v], expected[v]);
+                auto p = sp.path(v);
+                EXPECT_EQ(p.front(), s);
+                EXPECT_EQ(p.back(), v);
+            }
+        }
+    }
+}
+
+TEST_CASE(dijkstra_dary_heap_matches_bellman_ford)
+{
+    check_random_graphs<cp::DaryHeap<cp::ll>>();
+}
+
+TEST_CASE(dijkstra_radix_heap_matches_bellman_ford)
+{
+    check_random_graphs<cp::RadixHeap<cp::ll>>();
+}
+
+TEST_CASE(dijkstra_reset_touches_only_reached_vertices)
+{
+    // two components: 0-1-2 and 3-4
+    Edges edges = {{0, 1, 5}, {1, 2, 7}, {3, 4, 1}};
+    cp::CSRGraph<int, cp::ll> g(5, edges, false);
+    cp::Dijkstra<cp::DaryHeap<cp::ll>> sp(g);
+    sp.run(0);
+    EXPECT_EQ(sp.dist[2], 12);
+    EXPECT_EQ(sp.touched.size(), 3u);
+    sp.run(3);
+    EXPECT_EQ(sp.dist[4], 1);
+    EXPECT_EQ(sp.dist[0], sp.UNREACHED);
+    EXPECT_EQ(sp.dist[2], sp.UNREACHED);
+    EXPECT_EQ(sp.touched.size(), 2u);
+    EXPECT_EQ(sp.path(4), (std::vector<int>{3, 4}));
+}
+
+TEST_CASE(dijkstra_early_exit_at_target)
+{
+    // a path 0-1-...-999 with unit weights; stopping at 10 must not reach the far end
+    Edges edges;
+    for (int v = 1; v < 1000; v++) {
+        edges.push_back({v - 1, v, 1});
+    }
+    cp::CSRGraph<int, cp::ll> g(1000, edges, false);
+    cp::Dijkstra<cp::RadixHeap<cp::ll>> sp(g);
+    sp.run(0, 10);
+    EXPECT_EQ(sp.dist[10], 10);
+    EXPECT_EQ(sp.dist[500], sp.UNREACHED);
+    EXPECT_TRUE(sp.touched.size() <= 12u);
+    sp.run(999);
+    EXPECT_EQ(sp.dist[0], 999);
+}
+
+TEST_CASE(dary_heap_decrease_key_order)
+{
+    std::mt19937 rng(1);
+    int n = 1000;
+    cp::DaryHeap<int> h;
+    h.resize(n);
+    std::vector<int> key(n);
+    for (int v = 0; v < n; v++) {
+        key[v] = rng() % 100000;
+        h.push(v, key[v]);
+    }
+    for (int it = 0; it < 3000; it++) {
+        int v = rng() % n;
+        int k = rng() % 100000;
+        h.push(v, k); // only takes effect when lower
+        key[v] = std::min(key[v], k);
+    }
+    EXPECT_EQ(h.size(), n);
+    int prev = -1;
+    std::vector<char> seen(n, 0);
+    while (!h.empty()) {
+        auto [k, v] = h.pop();
+        EXPECT_EQ(k, key[v]);
+        EXPECT_TRUE(k >= prev);
+        EXPECT_FALSE(seen[v]);
+        seen[v] = 1;
+        prev = k;
+    }
+}
+
+TEST_CASE(radix_heap_monotone_order)
+{
+    std::mt19937_64 rng(2);
+    cp::RadixHeap<cp::ull> h;
+    std::multiset<cp::ull> ref;
+    cp::ull floor = 0;
+    for (int it = 0; it < 20000; it++) {
+        if (ref.empty() || rng() % 3) {
+            cp::ull k = floor + (rng() >> (rng() % 64));
+            h.push(it, k);
+            ref.insert(k);
+        }
+        else {
+            auto [k, v] = h.pop();
+            EXPECT_EQ(k, *ref.begin());
+            ref.erase(ref.begin());
+            floor = k;
+        }
+    }
+    EXPECT_EQ(h.size(), (int)ref.size());
+    h.clear();
+    EXPECT_TRUE(h.empty());
+    h.push(0, 0); // the floor is back at 0
+    EXPECT_EQ(h.pop().first, 0u);
+}
+
+TEST_CASE(dijkstra_assertions)
+{
+    Edges negative = {{0, 1, -1}};
+    cp::CSRGraph<int, cp::ll> bad(2, negative);
+    EXPECT_ABORT(cp::Dijkstra<cp::DaryHeap<cp::ll>>{bad});
+    cp::CSRGraph<int, cp::ll> unweighted(2, {{0, 1}});
+    EXPECT_ABORT(cp::Dijkstra<cp::DaryHeap<cp::ll>>{unweighted});
+    cp::CSRGraph<int, cp::ll> g(2, Edges{{0, 1, 3}});
+    cp::Dijkstra<cp::RadixHeap<cp::ll>> sp(g);
+    EXPECT_ABORT(sp.run(2));
+    EXPECT_ABORT(sp.path(-1));
+    cp::RadixHeap<cp::ll> h;
+    h.push(0, 5);
+    h.pop();
+    EXPECT_ABORT(h.push(1, 4)); // below the last popped key
+}
@@ -0,0 +1,171 @@
+#include "../framework/random_tree.hpp"
+#include "../framework/test_framework.hpp"
+#include "cp/graph/hld.hpp"
+
+// Vertices on the path u-v, by walking parents in a naive BFS tree.
+static std::vector<int> naive_path(const cp::HLD &h, int u, int v)
+{
+    std::vector<int> a, b;
+    while (u != v) {
+        if (h.depth[u] >= h.depth[v]) {
+            a.push_back(u);
+            u = h.parent[u];
+        }
+        else {
+            b.push_back(v);
+            v = h.parent[v];
+        }
+    }
+    a.push_back(u);
+    a.insert(a.end(), b.rbegin(), b.rend());
+    return a;
+}
+
+TEST_CASE(hld_layout_invariants)
+{
+    std::mt19937 rng(41);
+    int n = 200;
+    cp::CSRGraph<> g(n, cp_test::random_tree(rng, n), false);
+    cp::HLD h(g, 7);
+    EXPECT_EQ(h.parent[7], -1);
+    EXPECT_EQ(h.pos[7], 0);
+    for (int v = 0; v < n; v++) {
+        EXPECT_EQ(h.order[h.pos[v]], v);
+        if (h.heavy[v] != -1) {
+            EXPECT_EQ(h.pos[h.heavy[v]], h.pos[v] + 1); // heavy paths are contiguous
+            EXPECT_EQ(h.head[h.heavy[v]], h.head[v]);
+        }
+        auto [l, r] = h.subtree_range(v);
+        for (int i = l; i <= r; i++) {
+            int w = h.order[i]; // every position in the range is a descendant
+            while (w != -1 && w != v) {
+                w = h.parent[w];
+            }
+            EXPECT_EQ(w, v);
+        }
+    }
+}
+
+TEST_CASE(hld_lca_and_path_ranges)
+{
+    std::mt19937 rng(42);
+    int n = 100;
+    cp::CSRGraph<> g(n, cp_test::random_tree(rng, n), false);
+    cp::HLD h(g);
+    for (int iter = 0; iter < 300; iter++) {
+        int u = rng() % n, v = rng() % n;
+        std::vector<int> path = naive_path(h, u, v);
+        int lca = *std::min_element(path.begin(), path.end(), [&](int a, int b) {
+            return h.depth[a] < h.depth[b];
+        });
+        EXPECT_EQ(h.lca(u, v), lca);
+        for (bool exclude : {false, true}) {
+            std::vector<int> covered;
+            h.for_each_path_range(
+                u,
+                v,
+                [&](int l, int r) {
+                    for (int i = l; i <= r; i++) {
+                        covered.push_back(h.order[i]);
+                    }
+                },
+                exclude);
+            std::vector<int> expected = path;
+            if (exclude) {
+                expected.erase(std::find(expected.begin(), expected.end(), lca));
+            }
+            std::sort(covered.begin(), covered.end());
+            std::sort(expected.begin(), expected.end());
+            EXPECT_EQ(covered, expected);
+        }
+    }
+}
+
+TEST_CASE(hld_range_seg_tree_sum_add)
+{
+    std::mt19937 rng(43);
+    int n = 150;
+    cp::CSRGraph<> g(n, cp_test::random_tree(rng, n), false);
+    std::vector<cp::ll> val(n);
+    for (auto &x : val) {
+        x = rng() % 100;
+    }
+    cp::HLDRangeSegTree<cp::LongSumAddPolicy> t(g, val, 3);
+    for (int iter = 0; iter < 500; iter++) {
+        int u = rng() % n, v = rng() % n;
+        cp::ll x = (cp::ll)(rng() % 21) - 10;
+        std::vector<int> path = naive_path(t.hld, u, v);
+        switch (rng() % 4) {
+        case 0:
+            t.path_update(u, v, x);
+            for (int w : path) {
+                val[w] += x;
+            }
+            break;
+        case 1: {
+            cp::ll sum = 0;
+            for (int w : path) {
+                sum += val[w];
+            }
+            EXPECT_EQ(t.path_query(u, v), sum);
+            break;
+        }
+        case 2: {
+            t.subtree_update(u, x);
+            auto [l, r] = t.hld.subtree_range(u);
+            for (int i = l; i <= r; i++) {
+                val[t.hld.order[i]] += x;
+            }
+            break;
+        }
+        default: {
+            auto [l, r] = t.hld.subtree_range(u);
+            cp::ll sum = 0;
+            for (int i = l; i <= r; i++) {
+                sum += val[t.hld.order[i]];
+            }
+            EXPECT_EQ(t.subtree_query(u), sum);
+        }
+        }
+    }
+}
+
+TEST_CASE(hld_range_seg_tree_min_set)
+{
+    // 0 - 1 - 2 - 3, with 4 hanging off 1
+    std::vector<std::pair<int, int>> edges = {{0, 1}, {1, 2}, {2, 3}, {1, 4}};
+    cp::CSRGraph<> g(5, edges, false);
+    cp::HLDRangeSegTree<cp::LongMinSetPolicy> t(g, {5, 4, 3, 2, 1});
+    EXPECT_EQ(t.path_query(0, 3), 2LL);
+    EXPECT_EQ(t.path_query(4, 2), 1LL);
+    t.path_update(3, 4, 10); // 3, 2, 1, 4 become 10
+    EXPECT_EQ(t.path_query(0, 3), 5LL);
+    EXPECT_EQ(t.subtree_query(1), 10LL);
+    t.subtree_update(2, 0);
+    EXPECT_EQ(t.subtree_query(1), 0LL);
+    EXPECT_EQ(t.path_query(0, 4), 5LL);
+}
+
+TEST_CASE(hld_deep_chain)
+{
+    int n = 300000; // a recursive DFS would need ~n stack frames
+    std::vector<std::pair<int, int>> edges;
+    for (int v = 1; v < n; v++) {
+        edges.push_back({v - 1, v});
+    }
+    cp::CSRGraph<> g(n, edges, false);
+    cp::HLDRangeSegTree<cp::LongSumAddPolicy> t(g);
+    t.path_update(0, n - 1, 1);
+    EXPECT_EQ(t.path_query(10, n - 11), (cp::ll)(n - 20));
+    EXPECT_EQ(t.subtree_query(n / 2), (cp::ll)(n - n / 2));
+    EXPECT_EQ(t.hld.lca(5, n - 1), 5);
+}
+
+TEST_CASE(hld_assertions)
+{
+    std::vector<std::pair<int, int>> edges = {{0, 1}};
+    cp::CSRGraph<> forest(3, edges, false);
+    EXPECT_ABORT((cp::HLD(forest)));
+    cp::CSRGraph<> g(2, edges, false);
+    EXPECT_ABORT((cp::HLD(g, 2)));
+}
@@ -0,0 +1,128 @@
+#include "../framework/random_tree.hpp"
+#include "../framework/test_framework.hpp"
+#include "cp/graph/lca.hpp"
+
+// Parents and depths by BFS from root, for the naive climbing LCA.
+struct NaiveTree
+{
+    std::vector<int> parent, depth;
+
+    NaiveTree(const cp::CSRGraph<> &g, int root) : parent(g.n, -1), depth(g.n, 0)
+    {
+        std::vector<int> q = {root};
+        std::vector<char> seen(g.n, 0);
+        seen[root] = 1;
+        for (size_t i = 0; i < q.size(); i++) {
+            for (int to : g.neighbors(q[i])) {
+                if (!seen[to]) {
+                    seen[to] = 1;
+                    parent[to] = q[i];
+                    depth[to] = depth[q[i]] + 1;
+                    q.push_back(to);
+                }
+            }
+        }
+    }
+
+    int lca(int u, int v) const
+    {
+        while (u != v) {
+            if (depth[u] >= depth[v]) {
+                u = parent[u];
+            }
+            else {
+                v = parent[v];
+            }
+        }
+        return u;
+    }
+};
+
+TEST_CASE(lca_matches_naive_on_random_trees)
+{
+    std::mt19937 rng(33);
+    for (int n : {1, 2, 3, 63, 64, 65, 130, 1000}) {
+        cp::CSRGraph<> g(n, cp_test::random_tree(rng, n), false);
+        int root = rng() % n;
+        cp::LCA lca(g, root);
+        NaiveTree naive(g, root);
+        for (int it = 0; it < 2000; it++) {
+            int u = rng() % n, v = rng() % n;
+            int w = naive.lca(u, v);
+            EXPECT_EQ(lca.query(u, v), w);
+            int d = naive.depth[u] + naive.depth[v] - 2 * naive.depth[w];
+            EXPECT_EQ(lca.dist(u, v), d);
+        }
+    }
+}
+
+TEST_CASE(lca_all_pairs_small)
+{
+    std::mt19937 rng(7);
+    int n = 150; // spans three blocks, so every range_min branch is hit
+    cp::CSRGraph<> g(n, cp_test::random_tree(rng, n), false);
+    cp::LCA lca(g);
+    NaiveTree naive(g, 0);
+    for (int u = 0; u < n; u++) {
+        for (int v = 0; v < n; v++) {
+            EXPECT_EQ(lca.query(u, v), naive.lca(u, v));
+        }
+    }
+}
+
+TEST_CASE(lca_batched_and_tarjan_match_single)
+{
+    std::mt19937 rng(5);
+    int n = 5000;
+    cp::CSRGraph<> g(n, cp_test::random_tree(rng, n), false);
+    cp::LCA lca(g, 17);
+    std::vector<std::pair<int, int>> qs(20000);
+    for (auto &[u, v] : qs) {
+        u = rng() % n;
+        v = rng() % 4 == 0 ? u : (int)(rng() % n);
+    }
+    std::vector<int> batched(qs.size()), offline(qs.size());
+    lca.query(qs, batched);
+    cp::tarjan_lca(g, qs, offline, 17);
+    for (size_t i = 0; i < qs.size(); i++) {
+        int expected = lca.query(qs[i].first, qs[i].second);
+        EXPECT_EQ(batched[i], expected);
+        EXPECT_EQ(offline[i], expected);
+    }
+}
+
+TEST_CASE(lca_deep_chain_and_star)
+{
+    int n = 1000000; // recursion this deep would overflow the stack
+    std::vector<std::pair<int, int>> chain, star;
+    for (int v = 1; v < n; v++) {
+        chain.push_back({v - 1, v});
+        star.push_back({0, v});
+    }
+    cp::CSRGraph<> gc(n, chain, false), gs(n, star, false);
+    cp::LCA lc(gc), ls(gs);
+    EXPECT_EQ(lc.query(n - 1, 12345), 12345);
+    EXPECT_EQ(lc.dist(0, n - 1), n - 1);
+    EXPECT_EQ(ls.query(n - 1, 12345), 0);
+    EXPECT_EQ(ls.query(0, 5), 0);
+    std::vector<std::pair<int, int>> qs = {{n - 1, 3}, {7, 7}, {n / 2, n / 3}};
+    std::vector<int> out(qs.size());
+    cp::tarjan_lca(gc, qs, out);
+    EXPECT_EQ(out[0], 3);
+    EXPECT_EQ(out[1], 7);
+    EXPECT_EQ(out[2], n / 3);
+}
+
+TEST_CASE(lca_assertions)
+{
+    cp::CSRGraph<> forest(4, {{0, 1}, {2, 3}}, false);
+    cp::CSRGraph<> g(3, {{0, 1}, {1, 2}}, false);
+    EXPECT_ABORT((cp::LCA(forest)));
+    EXPECT_ABORT((cp::LCA(g, 3)));
+    cp::LCA lca(g);
+    EXPECT_ABORT(lca.query(0, 3));
+    std::vector<std::pair<int, int>> qs = {{0, 1}, {1, 2}};
+    std::vector<int> small(1);
+    EXPECT_ABORT(lca.query(qs, small));
+    EXPECT_ABORT(cp::tarjan_lca(g, qs, small));
+}
@@ -0,0 +1,169 @@
+#include "../framework/test_framework.hpp"
+#include "cp/graph/lowlink.hpp"
+
+using Edges = std::vector<std::pair<int, int>>;
+
+// Number of connected components, ignoring vertex skip and edge index skip_edge.
+static int components(int n, const Edges &edges, int skip = -1, int skip_edge = -1)
+{
+    std::vector<int> p(n);
+    std::iota(p.begin(), p.end(), 0);
+    std::function<int(int)> find = [&](int x) {
+        return p[x] == x ? x : p[x] = find(p[x]);
+    };
+    for (int i = 0; i < (int)edges.size(); i++) {
+        auto [u, v] = edges[i];
+        if (i != skip_edge && u != skip && v != skip) {
+            p[find(u)] = find(v);
+        }
+    }
+    int c = 0;
+    for (int v = 0; v < n; v++) {
+        c += v != skip && find(v) == v;
+    }
+    return c;
+}
+
+// Biconnected: connected and no vertex whose removal disconnects it (for 3+ vertices).
+static bool biconnected(const std::vector<int> &vs, const Edges &edges)
+{
+    std::map<int, int> id;
+    for (int v : vs) {
+        id.emplace(v, id.size());
+    }
+    Edges sub;
+    for (auto [u, v] : edges) {
+        if (u != v && id.count(u) && id.count(v)) {
+            sub.push_back({id[u], id[v]});
+        }
+    }
+    int k = vs.size();
+    if (components(k, sub) != 1) {
+        return false;
+    }
+    for (int x = 0; x < k && k >= 3; x++) {
+        if (components(k, sub, x) != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE(lowlink_matches_brute_force)
+{
+    std::mt19937 rng(39);
+    for (int it = 0; it < 300; it++) {
+        int n = 1 + rng() % 10, m = rng() % 15;
+        Edges edges;
+        for (int i = 0; i < m; i++) {
+            edges.push_back({(int)(rng() % n), (int)(rng() % n)});
+        }
+        cp::CSRGraph<> g(n, edges, false);
+        cp::Lowlink lk(g);
+        int base = components(n, edges);
+
+        std::set<std::pair<int, int>> bridges;
+        for (auto [u, v] : lk.bridges) {
+            bridges.insert({std::min(u, v), std::max(u, v)});
+        }
+        std::set<std::pair<int, int>> expected;
+        for (int i = 0; i < m; i++) {
+            auto [u, v] = edges[i];
+            if (components(n, edges, -1, i) > base) {
+                expected.insert({std::min(u, v), std::max(u, v)});
+            }
+        }
+        EXPECT_EQ(bridges, expected);
+
+        for (int v = 0; v < n; v++) {
+            bool isolated = g.degree(v) == 0;
+            // removing a vertex drops it from the count, hence the -1
+            bool cut = components(n, edges, v) > base - (isolated ? 1 : 0);
+            EXPECT_EQ((bool)lk.articulation[v], cut);
+        }
+
+        // 2-edge-connected: same component iff connected without bridges
+        Edges kept;
+        for (auto [u, v] : edges) {
+            if (!expected.count({std::min(u, v), std::max(u, v)})) {
+                kept.push_back({u, v});
+            }
+        }
+        std::vector<int> p(n);
+        std::iota(p.begin(), p.end(), 0);
+        std::function<int(int)> find = [&](int x) {
+            return p[x] == x ? x : p[x] = find(p[x]);
+        };
+        for (auto [u, v] : kept) {
+            p[find(u)] = find(v);
+        }
+        for (int u = 0; u < n; u++) {
+            for (int v = 0; v < n; v++) {
+                bool same = lk.two_edge_comp[u] == lk.two_edge_comp[v];
+                EXPECT_EQ(same, find(u) == find(v));
+            }
+        }
+
+        // blocks: biconnected, pairwise share at most one vertex, cover every edge,
+        // and a vertex is in several blocks exactly when it is an articulation point
+        std::vector<std::set<int>> blocks;
+        std::vector<int> in_blocks(n, 0);
+        for (int i = 0; i < lk.num_bcc(); i++) {
+            auto b = lk.bcc(i);
+            std::vector<int> vs(b.begin(), b.end());
+            EXPECT_TRUE(biconnected(vs, edges));
+            blocks.push_back(std::set<int>(vs.begin(), vs.end()));
+            EXPECT_EQ(blocks.back().size(), vs.size());
+            for (int v : vs) {
+                in_blocks[v]++;
+            }
+        }
+        for (size_t i = 0; i < blocks.size(); i++) {
+            for (size_t j = i + 1; j < blocks.size(); j++) {
+                int common = 0;
+                for (int v : blocks[i]) {
+                    common += blocks[j].count(v);
+                }
+                EXPECT_TRUE(common <= 1);
+            }
+        }
+        for (auto [u, v] : edges) {
+            bool covered = false;
+            for (auto &b : blocks) {
+                covered |= b.count(u) && b.count(v);
+            }
+            EXPECT_TRUE(covered);
+        }
+        for (int v = 0; v < n; v++) {
+            EXPECT_EQ(in_blocks[v] > 1, (bool)lk.articulation[v]);
+            EXPECT_TRUE(in_blocks[v] >= 1);
+        }
+    }
+}
+
+TEST_CASE(lowlink_parallel_edges_are_not_bridges)
+{
+    cp::CSRGraph<> g(3, {{0, 1}, {0, 1}, {1, 2}}, false);
+    cp::Lowlink lk(g);
+    EXPECT_EQ(lk.bridges.size(), 1u);
+    EXPECT_EQ(lk.two_edge_count, 2);
+    EXPECT_EQ(lk.two_edge_comp[0], lk.two_edge_comp[1]);
+    EXPECT_TRUE(lk.articulation[1]);
+    EXPECT_EQ(lk.num_bcc(), 2);
+}
+
+TEST_CASE(lowlink_long_chain)
+{
+    int n = 2000000;
+    Edges chain;
+    for (int v = 1; v < n; v++) {
+        chain.push_back({v - 1, v});
+    }
+    cp::Lowlink lk(cp::CSRGraph<>(n, chain, false));
+    EXPECT_EQ((int)lk.bridges.size(), n - 1);
+    EXPECT_EQ(lk.two_edge_count, n);
+    EXPECT_EQ(lk.num_bcc(), n - 1);
+    EXPECT_FALSE(lk.articulation[0]);
+    EXPECT_TRUE(lk.articulation[1]);
+    EXPECT_ABORT(lk.bcc(n - 1));
+}
@@ -0,0 +1,121 @@
+#include "../framework/test_framework.hpp"
+#include "cp/graph/max_flow.hpp"
+
+// Edmonds-Karp on a capacity matrix.
+static cp::ll naive_max_flow(std::vector<std::vector<cp::ll>> c, int s, int t)
+{
+    int n = c.size();
+    cp::ll total = 0;
+    while (true) {
+        std::vector<int> prev(n, -1);
+        std::vector<int> q = {s};
+        prev[s] = s;
+        for (size_t i = 0; i < q.size(); i++) {
+            for (int v = 0; v < n; v++) {
+                if (prev[v] == -1 && c[q[i]][v] > 0) {
+                    prev[v] = q[i];
+                    q.push_back(v);
+                }
+            }
+        }
+        if (prev[t] == -1) {
+            return total;
+        }
+        cp::ll f = LLONG_MAX;
+        for (int v = t; v != s; v = prev[v]) {
+            f = std::min(f, c[prev[v]][v]);
+        }
+        for (int v = t; v != s; v = prev[v]) {
+            c[prev[v]][v] -= f;
+            c[v][prev[v]] += f;
+        }
+        total += f;
+    }
+}
+
+TEST_CASE(dinic_matches_edmonds_karp)
+{
+    std::mt19937 rng(36);
+    for (int it = 0; it < 200; it++) {
+        int n = 2 + rng() % 12, m = rng() % 40;
+        cp::Dinic<cp::ll> f(n);
+        std::vector<std::vector<cp::ll>> c(n, std::vector<cp::ll>(n, 0));
+        std::vector<std::tuple<int, int, int>> added;
+        for (int i = 0; i < m; i++) {
+            int u = rng() % n, v = rng() % n, cap = rng() % 20;
+            int e = f.add_edge(u, v, cap);
+            added.push_back({e, u, v});
+            if (u != v) {
+                c[u][v] += cap;
+            }
+        }
+        cp::ll flow = f.max_flow(0, n - 1);
+        EXPECT_EQ(flow, naive_max_flow(c, 0, n - 1));
+        // conservation at inner vertices, capacity limits, and the cut equals the flow
+        std::vector<cp::ll> excess(n, 0);
+        cp::ll cut = 0;
+        for (auto [e, u, v] : added) {
+            EXPECT_TRUE(f.flow(e) >= 0 && f.flow(e) <= f.original[e]);
+            excess[u] -= f.flow(e);
+            excess[v] += f.flow(e);
+            if (f.source_side(u) && !f.source_side(v)) {
+                cut += f.original[e];
+            }
+        }
+        for (int v = 1; v < n - 1; v++) {
+            EXPECT_EQ(excess[v], 0);
+        }
+        EXPECT_EQ(excess[n - 1], flow);
+        EXPECT_EQ(cut, flow);
+        EXPECT_TRUE(f.source_side(0));
+        EXPECT_FALSE(f.source_side(n - 1));
+    }
+}
+
+TEST_CASE(dinic_undirected_edges_and_incremental)
+{
+    // 0 -- 1 -- 2 with undirected capacities 5 and 3
+    cp::Dinic<int> f(3);
+    int a = f.add_edge(0, 1, 5, 5);
+    f.add_edge(1, 2, 3, 3);
+    EXPECT_EQ(f.max_flow(2, 0), 3);
+    EXPECT_EQ(f.flow(a), -3); // flow runs 1 -> 0, against edge a
+    f.add_edge(2, 0, 4);
+    EXPECT_EQ(f.max_flow(2, 0), 4); // only the new capacity is added
+}
+
+TEST_CASE(dinic_long_chain)
+{
+    // s -> 1 -> 2 -> ... -> n-1 plus parallel shortcuts: a deep level graph
+    int n = 1000000;
+    cp::Dinic<cp::ll> f(n);
+    for (int v = 1; v < n; v++) {
+        f.add_edge(v - 1, v, 7);
+    }
+    EXPECT_EQ(f.max_flow(0, n - 1), 7);
+}
+
+TEST_CASE(dinic_unit_bipartite)
+{
+    // perfect matching on left i - right i and i + 1: expect n
+    int n = 100000, s = 2 * n, t = 2 * n + 1;
+    cp::Dinic<int> f(2 * n + 2);
+    for (int i = 0; i < n; i++) {
+        f.add_edge(s, i, 1);
+        f.add_edge(n + i, t, 1);
+        f.add_edge(i, n + i, 1);
+        if (i + 1 < n) {
+            f.add_edge(i, n + i + 1, 1);
+        }
+    }
+    EXPECT_EQ(f.max_flow(s, t), n);
+}
+
+TEST_CASE(dinic_assertions)
+{
+    cp::Dinic<int> f(3);
+    EXPECT_ABORT(f.add_edge(0, 3, 1));
+    EXPECT_ABORT(f.add_edge(0, 1, -1));
+    EXPECT_ABORT(f.max_flow(1, 1));
+    EXPECT_ABORT(f.max_flow(0, 3));
+}
@@ -0,0 +1,139 @@
+#include "../framework/test_framework.hpp"
+#include "cp/graph/mst.hpp"
+
+using Edges = std::vector<std::tuple<int, int, cp::ll>>;
+
+// O(V^2) Prim per component as the reference total weight.
+static cp::ll naive_msf_weight(int n, const Edges &edges)
+{
+    std::vector<std::vector<cp::ll>> w(n, std::vector<cp::ll>(n, cp::INF64));
+    for (auto [u, v, c] : edges) {
+        w[u][v] = w[v][u] = std::min(w[u][v], c);
+    }
+    std::vector<bool> done(n, false);
+    cp::ll total = 0;
+    for (int s = 0; s < n; s++) {
+        if (done[s]) {
+            continue;
+        }
+        std::vector<cp::ll> dist(n, cp::INF64);
+        dist[s] = 0;
+        while (true) {
+            int u = -1;
+            for (int v = 0; v < n; v++) {
+                bool reachable = !done[v] && dist[v] < cp::INF64;
+                if (reachable && (u == -1 || dist[v] < dist[u])) {
+                    u = v;
+                }
+            }
+            if (u == -1) {
+                break;
+            }
+            done[u] = true;
+            total += dist[u];
+            for (int v = 0; v < n; v++) {
+                dist[v] = std::min(dist[v], w[u][v]);
+            }
+        }
+    }
+    return total;
+}
+
+static Edges random_edges(std::mt19937 &rng, int n, int m, cp::ll lo, cp::ll hi)
+{
+    Edges edges(m);
+    for (auto &[u, v, w] : edges) {
+        u = rng() % n;
+        v = rng() % n;
+        w = lo + (cp::ll)(rng() % (hi - lo + 1));
+    }
+    return edges;
+}
+
+TEST_CASE(mst_sort_edges_by_weight)
+{
+    cp::ll big = 1LL << 40;
+    Edges edges = {{0, 1, 5}, {0, 1, -3}, {0, 1, big}, {0, 1, 5}, {0, 1, -big}};
+    auto order = cp::sort_edges_by_weight(edges);
+    EXPECT_EQ(order, (std::vector<int>{4, 1, 0, 3, 2})); // stable on the tie
+}
+
+TEST_CASE(mst_small_graph)
+{
+    Edges edges = {{0, 1, 4}, {0, 2, 1}, {1, 2, 2}, {1, 3, 5}, {2, 3, 8}};
+    std::vector<int> out(3);
+    auto k = cp::kruskal(4, edges, out);
+    EXPECT_EQ(k.weight, 8LL);
+    EXPECT_EQ(k.edges, 3);
+    EXPECT_EQ(out, (std::vector<int>{1, 2, 3}));
+    auto b = cp::boruvka(4, edges, 2, out);
+    EXPECT_EQ(b.weight, 8LL);
+    EXPECT_EQ(b.edges, 3);
+    std::sort(out.begin(), out.end());
+    EXPECT_EQ(out, (std::vector<int>{1, 2, 3}));
+}
+
+TEST_CASE(mst_disconnected_forest)
+{
+    Edges edges = {{0, 1, 3}, {2, 3, 4}, {3, 2, 1}, {4, 4, 0}};
+    auto k = cp::kruskal(5, edges);
+    EXPECT_EQ(k.weight, 4LL);
+    EXPECT_EQ(k.edges, 2);
+    auto b = cp::boruvka(5, edges, 3);
+    EXPECT_EQ(b.weight, 4LL);
+    EXPECT_EQ(b.edges, 2);
+}
+
+TEST_CASE(mst_random_against_prim)
+{
+    std::mt19937 rng(31);
+    for (int iter = 0; iter < 40; iter++) {
+        int n = 1 + rng() % 40;
+        int m = rng() % 150;
+        // narrow weight ranges force many ties
+        Edges edges = random_edges(rng, n, m, -5, iter % 2 ? 5 : 1000000000000LL);
+        cp::ll expected = naive_msf_weight(n, edges);
+        std::vector<int> kout(n), bout(n);
+        auto k = cp::kruskal(n, edges, kout);
+        auto b = cp::boruvka(n, edges, 1 + iter % 4, bout);
+        EXPECT_EQ(k.weight, expected);
+        EXPECT_EQ(b.weight, expected);
+        EXPECT_EQ(k.edges, b.edges);
+        // the reported edges must form a forest with the reported weight
+        cp::DSU d(n);
+        cp::ll sum = 0;
+        for (int i = 0; i < b.edges; i++) {
+            auto [u, v, w] = edges[bout[i]];
+            EXPECT_FALSE(d.same(u, v));
+            d.merge(u, v);
+            sum += w;
+        }
+        EXPECT_EQ(sum, expected);
+    }
+}
+
+TEST_CASE(mst_boruvka_large_parallel)
+{
+    std::mt19937 rng(32);
+    int n = 20000;
+    Edges edges = random_edges(rng, n, 100000, 0, 1000);
+    auto k = cp::kruskal(n, edges);
+    auto b = cp::boruvka(n, edges, 4);
+    EXPECT_EQ(b.weight, k.weight);
+    EXPECT_EQ(b.edges, k.edges);
+}
+
+TEST_CASE(mst_unsigned_weights)
+{
+    std::vector<std::tuple<int, int, unsigned>> edges = {{0, 1, 4000000000u},
+                                                         {1, 2, 7u}};
+    EXPECT_EQ(cp::kruskal(3, edges).weight, 4000000007u);
+}
+
+TEST_CASE(mst_assertions)
+{
+    Edges edges = {{0, 1, 1}};
+    std::vector<int> small(1);
+    EXPECT_ABORT(cp::kruskal(3, edges, small));
+    EXPECT_ABORT(cp::boruvka(3, edges, 1, small));
+}
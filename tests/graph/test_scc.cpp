@@ -0,0 +1,113 @@
+#include "../framework/test_framework.hpp"
+#include "cp/graph/scc.hpp"
+
+// reach[u][v] by DFS from every vertex.
+static std::vector<std::vector<char>> reachability(const cp::CSRGraph<> &g)
+{
+    std::vector<std::vector<char>> reach(g.n, std::vector<char>(g.n, 0));
+    for (int s = 0; s < g.n; s++) {
+        std::vector<int> st = {s};
+        reach[s][s] = 1;
+        while (!st.empty()) {
+            int v = st.back();
+            st.pop_back();
+            for (int to : g.neighbors(v)) {
+                if (!reach[s][to]) {
+                    reach[s][to] = 1;
+                    st.push_back(to);
+                }
+            }
+        }
+    }
+    return reach;
+}
+
+TEST_CASE(scc_matches_mutual_reachability)
+{
+    std::mt19937 rng(37);
+    for (int it = 0; it < 200; it++) {
+        int n = 1 + rng() % 12, m = rng() % 30;
+        std::vector<std::pair<int, int>> edges;
+        for (int i = 0; i < m; i++) {
+            edges.push_back({(int)(rng() % n), (int)(rng() % n)});
+        }
+        cp::CSRGraph<> g(n, edges);
+        cp::SCC scc(g);
+        auto reach = reachability(g);
+        for (int u = 0; u < n; u++) {
+            EXPECT_TRUE(scc.comp[u] >= 0 && scc.comp[u] < scc.count);
+            for (int v = 0; v < n; v++) {
+                EXPECT_EQ(scc.comp[u] == scc.comp[v], reach[u][v] && reach[v][u]);
+            }
+        }
+        for (auto [u, v] : edges) { // reverse topological ids
+            EXPECT_TRUE(scc.comp[u] >= scc.comp[v]);
+        }
+    }
+}
+
+TEST_CASE(scc_long_chain_and_cycle)
+{
+    int n = 2000000;
+    std::vector<std::pair<int, int>> chain;
+    for (int v = 1; v < n; v++) {
+        chain.push_back({v - 1, v});
+    }
+    cp::SCC a(cp::CSRGraph<>(n, chain));
+    EXPECT_EQ(a.count, n);
+    EXPECT_EQ(a.comp[0], n - 1); // the source comes last
+    EXPECT_EQ(a.comp[n - 1], 0);
+    chain.push_back({n - 1, 0});
+    cp::SCC b(cp::CSRGraph<>(n, chain));
+    EXPECT_EQ(b.count, 1);
+}
+
+TEST_CASE(two_sat_matches_brute_force)
+{
+    std::mt19937 rng(38);
+    for (int it = 0; it < 300; it++) {
+        int n = 1 + rng() % 6, m = rng() % 12;
+        cp::TwoSat sat(n);
+        std::vector<std::tuple<int, bool, int, bool>> clauses;
+        for (int i = 0; i < m; i++) {
+            int a = rng() % n, b = rng() % n;
+            bool va = rng() % 2, vb = rng() % 2;
+            clauses.push_back({a, va, b, vb});
+            sat.add_clause(a, va, b, vb);
+        }
+        auto holds = [&](int mask) {
+            for (auto [a, va, b, vb] : clauses) {
+                if ((mask >> a & 1) != va && (mask >> b & 1) != vb) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        bool any = false;
+        for (int mask = 0; mask < (1 << n); mask++) {
+            any |= holds(mask);
+        }
+        EXPECT_EQ(sat.solve(), any);
+        if (any) {
+            int mask = 0;
+            for (int i = 0; i < n; i++) {
+                mask |= sat.value[i] << i;
+            }
+            EXPECT_TRUE(holds(mask));
+        }
+    }
+}
+
+TEST_CASE(two_sat_implications_and_forced_values)
+{
+    // x0 -> x1 -> x2, x0 forced true: everything true
+    cp::TwoSat sat(3);
+    sat.add_implication(0, true, 1, true);
+    sat.add_implication(1, true, 2, true);
+    sat.set_value(0, true);
+    EXPECT_TRUE(sat.solve());
+    EXPECT_EQ(sat.value, (std::vector<char>{1, 1, 1}));
+    sat.set_value(2, false);
+    EXPECT_FALSE(sat.solve());
+    EXPECT_ABORT(sat.add_clause(0, true, 3, true));
+}
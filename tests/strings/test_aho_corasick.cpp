@@ -0,0 +1,169 @@
+#include "../framework/test_framework.hpp"
+#include "cp/strings/aho_corasick.hpp"
+
+// Brute-force reference: every (pattern_id, end) pair, sorted.
+static std::vector<std::pair<int, long long>>
+naive_matches(const std::vector<std::string> &patterns, const std::string &text)
+{
+    std::vector<std::pair<int, long long>> res;
+    for (int id = 0; id < (int)patterns.size(); id++) {
+        const std::string &p = patterns[id];
+        for (size_t i = 0; i + p.size() <= text.size(); i++) {
+            if (text.compare(i, p.size(), p) == 0) {
+                res.push_back({id, (long long)(i + p.size() - 1)});
+            }
+        }
+    }
+    std::sort(res.begin(), res.end());
+    return res;
+}
+
+template <typename AC>
+static std::vector<std::pair<int, long long>>
+feed_chunks(AC &ac, const std::string &text, size_t chunk)
+{
+    std::vector<std::pair<int, long long>> res;
+    auto on_match = [&](int id, long long end) { res.push_back({id, end}); };
+    for (size_t i = 0; i < text.size(); i += chunk) {
+        ac.feed(std::string_view(text).substr(i, chunk), on_match);
+    }
+    std::sort(res.begin(), res.end());
+    return res;
+}
+
+TEST_CASE(aho_corasick_classic_example)
+{
+    std::vector<std::string> patterns = {"he", "she", "his", "hers"};
+    cp::AhoCorasick<> ac;
+    for (auto &p : patterns) {
+        ac.add(p);
+    }
+    ac.build();
+    auto got = feed_chunks(ac, "ushers", 6);
+    // "she" and "he" end at 3, "hers" ends at 5
+    std::vector<std::pair<int, long long>> expected = {{0, 3}, {1, 3}, {3, 5}};
+    EXPECT_EQ(got, expected);
+}
+
+TEST_CASE(aho_corasick_duplicate_and_nested_patterns)
+{
+    std::vector<std::string> patterns = {"a", "aa", "a", "aaa"};
+    cp::AhoCorasick<> ac;
+    for (auto &p : patterns) {
+        ac.add(p);
+    }
+    ac.build();
+    std::string text = "aaaa";
+    EXPECT_EQ(feed_chunks(ac, text, 4), naive_matches(patterns, text));
+}
+
+TEST_CASE(aho_corasick_streaming_matches_span_chunks)
+{
+    std::vector<std::string> patterns = {"abcab", "bca", "cabc", "b"};
+    std::string text = "abcabcabcabxabcab";
+    auto expected = naive_matches(patterns, text);
+    for (size_t chunk : {1u, 2u, 3u, 5u, 100u}) {
+        cp::AhoCorasick<> ac;
+        for (auto &p : patterns) {
+            ac.add(p);
+        }
+        ac.build();
+        EXPECT_EQ(feed_chunks(ac, text, chunk), expected);
+        EXPECT_EQ(ac.pos, (long long)text.size());
+    }
+}
+
+TEST_CASE(aho_corasick_reset)
+{
+    cp::AhoCorasick<> ac;
+    ac.add("ab");
+    ac.build();
+    int count = 0;
+    auto on_match = [&](int, long long) { count++; };
+    ac.feed("a", on_match);
+    ac.reset();
+    ac.feed("b", on_match); // "a" was discarded by reset
+    EXPECT_EQ(count, 0);
+    ac.feed("ab", on_match);
+    EXPECT_EQ(count, 1);
+}
+
+TEST_CASE(aho_corasick_random_against_naive)
+{
+    std::mt19937 rng(12345);
+    for (int iter = 0; iter < 50; iter++) {
+        std::vector<std::string> patterns(1 + rng() % 8);
+        for (auto &p : patterns) {
+            p.resize(1 + rng() % 4);
+            for (char &ch : p) {
+                ch = 'a' + rng() % 3;
+            }
+        }
+        std::string text(rng() % 60, 'a');
+        for (char &ch : text) {
+            ch = 'a' + rng() % 3;
+        }
+        cp::AhoCorasick<3> ac;
+        cp::DoubleArrayAhoCorasick da;
+        for (auto &p : patterns) {
+            ac.add(p);
+            da.add(p);
+        }
+        ac.build();
+        da.build();
+        auto expected = naive_matches(patterns, text);
+        EXPECT_EQ(feed_chunks(ac, text, 1 + rng() % 7), expected);
+        EXPECT_EQ(feed_chunks(da, text, 1 + rng() % 7), expected);
+    }
+}
+
+TEST_CASE(double_array_aho_corasick_binary_bytes)
+{
+    std::vector<std::string> patterns = {std::string("\x00\xff", 2),
+                                         std::string("\xff\x00\xff", 3),
+                                         "ab",
+                                         std::string("b\x80", 2)};
+    std::string text = std::string("\xff\x00\xff\x00\xff", 5) + "ab\x80";
+    cp::DoubleArrayAhoCorasick da;
+    for (auto &p : patterns) {
+        da.add(p);
+    }
+    da.build();
+    EXPECT_EQ(feed_chunks(da, text, 2), naive_matches(patterns, text));
+}
+
+TEST_CASE(double_array_aho_corasick_many_patterns)
+{
+    std::mt19937 rng(7);
+    std::vector<std::string> patterns(300);
+    for (auto &p : patterns) {
+        p.resize(2 + rng() % 6);
+        for (char &ch : p) {
+            ch = (char)(rng() % 256);
+        }
+    }
+    std::string text(5000, 0);
+    for (char &ch : text) {
+        ch = (char)(rng() % 256);
+    }
+    // plant a few patterns so matches actually occur
+    for (int i = 0; i < 20; i++) {
+        const std::string &p = patterns[rng() % patterns.size()];
+        text.replace(rng() % (text.size() - p.size()), p.size(), p);
+    }
+    cp::DoubleArrayAhoCorasick da;
+    for (auto &p : patterns) {
+        da.add(p);
+    }
+    da.build();
+    auto expected = naive_matches(patterns, text);
+    EXPECT_TRUE(expected.size() >= 20u);
+    EXPECT_EQ(feed_chunks(da, text, 97), expected);
+}
+
+TEST_CASE(aho_corasick_assertions)
+{
+    cp::AhoCorasick<> ac;
+    EXPECT_ABORT(ac.add(""));
+    EXPECT_ABORT(ac.add("aBc"));
+}
@@ -0,0 +1,112 @@
+#include "../framework/test_framework.hpp"
+#include "cp/strings/hashing.hpp"
+
+TEST_CASE(hash61_mul_matches_int128_mod)
+{
+    std::mt19937_64 rng(1);
+    for (int i = 0; i < 1000; i++) {
+        cp::ull a = rng() % cp::Hash61::MOD;
+        cp::ull b = rng() % cp::Hash61::MOD;
+        cp::ull expected = (cp::ull)((cp::u128)a * b % cp::Hash61::MOD);
+        EXPECT_EQ(cp::Hash61::mul(a, b), expected);
+    }
+    cp::ull m1 = cp::Hash61::MOD - 1;
+    EXPECT_EQ(cp::Hash61::mul(m1, m1), 1ULL); // (-1)^2
+    EXPECT_EQ(cp::Hash61::add(m1, 1), 0ULL);
+    EXPECT_EQ(cp::Hash61::sub(0, 1), m1);
+}
+
+TEST_CASE(rolling_hash_equal_substrings)
+{
+    cp::RollingHash h("abracadabra");
+    EXPECT_EQ(h.get(0, 4), h.get(7, 11)); // "abra"
+    EXPECT_FALSE(h.get(0, 4) == h.get(1, 5));
+    EXPECT_EQ(h.get(3, 3), 0ULL); // empty substring
+}
+
+TEST_CASE(rolling_hash_shared_base_across_instances)
+{
+    cp::RollingHash a("xxhelloxx"), b("hello");
+    EXPECT_EQ(a.get(2, 7), b.get(0, 5));
+    cp::RollingHash c("hello", 12345), d("hello", 54321);
+    EXPECT_FALSE(c.get(0, 5) == d.get(0, 5));
+}
+
+TEST_CASE(rolling_hash_nul_characters)
+{
+    std::string s("\0\0a", 3);
+    cp::RollingHash h(s);
+    EXPECT_FALSE(h.get(0, 1) == h.get(0, 0));
+    EXPECT_FALSE(h.get(0, 2) == h.get(0, 1));
+    EXPECT_EQ(h.get(0, 1), h.get(1, 2));
+}
+
+TEST_CASE(rolling_hash_concat)
+{
+    cp::RollingHash h("foobar");
+    EXPECT_EQ(h.concat(h.get(0, 3), h.get(3, 6), 3), h.get(0, 6));
+}
+
+TEST_CASE(rolling_hash_windows_match_get)
+{
+    std::string s = "mississippimississippi";
+    cp::RollingHash h(s);
+    for (int len = 0; len <= (int)s.size(); len++) {
+        auto w = h.windows(len);
+        EXPECT_EQ(w.size(), s.size() - len + 1);
+        for (int i = 0; i + len <= (int)s.size(); i++) {
+            EXPECT_EQ(w[i], h.get(i, i + len));
+        }
+    }
+}
+
+TEST_CASE(rolling_hash_distinct_windows)
+{
+    std::string s = "abababab";
+    cp::RollingHash h(s);
+    auto w = h.windows(3);
+    std::sort(w.begin(), w.end());
+    EXPECT_EQ(std::unique(w.begin(), w.end()) - w.begin(), 2); // "aba", "bab"
+}
+
+TEST_CASE(double_rolling_hash)
+{
+    std::string s = "abracadabra";
+    cp::DoubleRollingHash<> h(s);
+    EXPECT_EQ(h.get(0, 4), h.get(7, 11));
+    EXPECT_FALSE(h.get(0, 4) == h.get(1, 5));
+    auto w = h.windows(4);
+    for (int i = 0; i + 4 <= (int)s.size(); i++) {
+        EXPECT_EQ(w[i], h.get(i, i + 4));
+    }
+}
+
+TEST_CASE(double_rolling_hash_matches_direct_polynomial)
+{
+    // base 131 in both fields: hash("ab") = ('a' + 1) * 131 + ('b' + 1)
+    cp::DoubleRollingHash<> h("ab", 131, 131);
+    cp::ull v = ('a' + 1) * 131 + ('b' + 1);
+    EXPECT_EQ(h.get(0, 2), v << 32 | v);
+}
+
+TEST_CASE(double_rolling_hash_default_bases)
+{
+    auto [b1, b2] = cp::DoubleRollingHash<>::random_bases();
+    EXPECT_TRUE(2 <= b1 && b1 <= cp::MOD - 2);
+    EXPECT_TRUE(2 <= b2 && b2 <= 998244353 - 2);
+    cp::DoubleRollingHash<> h("x");
+    EXPECT_EQ(h.base1.val, b1);
+    EXPECT_EQ(h.base2.val, b2);
+    // Same modulus twice: the two bases are still separate draws.
+    auto [c1, c2] = cp::DoubleRollingHash<cp::MOD, cp::MOD>::random_bases();
+    EXPECT_FALSE(c1 == c2);
+}
+
+TEST_CASE(rolling_hash_assertions)
+{
+    cp::RollingHash h("abc");
+    EXPECT_ABORT(h.get(2, 1));
+    EXPECT_ABORT(h.get(0, 4));
+    EXPECT_ABORT(h.windows(4));
+    EXPECT_ABORT(cp::RollingHash("abc", 0));
+}
@@ -0,0 +1,57 @@
+#include "../framework/test_framework.hpp"
+#include "cp/strings/manacher.hpp"
+
+static bool is_palindrome(const std::string &s, int l, int len)
+{
+    for (int i = 0; i < len / 2; i++) {
+        if (s[l + i] != s[l + len - 1 - i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE(manacher_basic)
+{
+    auto [odd, even] = cp::manacher("abacaba");
+    EXPECT_EQ(odd, (std::vector<int>{1, 2, 1, 4, 1, 2, 1}));
+    EXPECT_EQ(even, (std::vector<int>{0, 0, 0, 0, 0, 0, 0}));
+    auto [odd2, even2] = cp::manacher("abba");
+    EXPECT_EQ(odd2, (std::vector<int>{1, 1, 1, 1}));
+    EXPECT_EQ(even2, (std::vector<int>{0, 0, 2, 0}));
+}
+
+TEST_CASE(manacher_random_against_naive)
+{
+    std::mt19937 rng(5);
+    std::vector<int> odd(50), even(50);
+    for (int iter = 0; iter < 200; iter++) {
+        std::string s(rng() % 50, 'a');
+        for (char &ch : s) {
+            ch = 'a' + rng() % 2;
+        }
+        int n = s.size();
+        cp::manacher(s, odd.data(), even.data());
+        for (int i = 0; i < n; i++) {
+            int k = 1;
+            while (i - k >= 0 && i + k < n && is_palindrome(s, i - k, 2 * k + 1)) {
+                k++;
+            }
+            EXPECT_EQ(odd[i], k);
+            k = 0;
+            while (i - k - 1 >= 0 && i + k < n &&
+                   is_palindrome(s, i - k - 1, 2 * k + 2)) {
+                k++;
+            }
+            EXPECT_EQ(even[i], k);
+        }
+    }
+}
+
+TEST_CASE(manacher_longest_palindrome)
+{
+    EXPECT_EQ(cp::longest_palindrome("forgeeksskeegfor"), (std::pair<int, int>{3, 10}));
+    EXPECT_EQ(cp::longest_palindrome("abacdfgdcaba"), (std::pair<int, int>{0, 3}));
+    EXPECT_EQ(cp::longest_palindrome("x"), (std::pair<int, int>{0, 1}));
+    EXPECT_EQ(cp::longest_palindrome(""), (std::pair<int, int>{0, 0}));
+}
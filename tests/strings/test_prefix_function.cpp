@@ -0,0 +1,82 @@
+#include "../framework/test_framework.hpp"
+#include "cp/strings/prefix_function.hpp"
+
+static std::vector<int> naive_pi(const std::string &s)
+{
+    int n = s.size();
+    std::vector<int> pi(n);
+    for (int i = 0; i < n; i++) {
+        for (int k = i; k > 0; k--) {
+            if (s.compare(0, k, s, i - k + 1, k) == 0) {
+                pi[i] = k;
+                break;
+            }
+        }
+    }
+    return pi;
+}
+
+TEST_CASE(prefix_function_basic)
+{
+    EXPECT_EQ(cp::prefix_function("abcabcd"), (std::vector<int>{0, 0, 0, 1, 2, 3, 0}));
+    EXPECT_EQ(cp::prefix_function("aabaaab"), (std::vector<int>{0, 1, 0, 1, 2, 2, 3}));
+    EXPECT_TRUE(cp::prefix_function("").empty());
+}
+
+TEST_CASE(prefix_function_random_against_naive)
+{
+    std::mt19937 rng(4);
+    std::vector<int> buf(40);
+    for (int iter = 0; iter < 200; iter++) {
+        std::string s(rng() % 40, 'a');
+        for (char &ch : s) {
+            ch = 'a' + rng() % 2;
+        }
+        cp::prefix_function(s, buf.data());
+        EXPECT_EQ(std::vector<int>(buf.begin(), buf.begin() + s.size()), naive_pi(s));
+    }
+}
+
+TEST_CASE(kmp_matcher_single_chunk)
+{
+    cp::KmpMatcher m("aba");
+    std::vector<long long> ends;
+    m.feed("ababababa", [&](long long end) { ends.push_back(end); });
+    EXPECT_EQ(ends, (std::vector<long long>{2, 4, 6, 8}));
+}
+
+TEST_CASE(kmp_matcher_streaming_matches_span_chunks)
+{
+    std::string pattern = "abcab";
+    std::string text = "abcabcabxabcababcab";
+    std::vector<long long> expected;
+    for (size_t i = 0; i + pattern.size() <= text.size(); i++) {
+        if (text.compare(i, pattern.size(), pattern) == 0) {
+            expected.push_back(i + pattern.size() - 1);
+        }
+    }
+    for (size_t chunk : {1u, 2u, 4u, 7u}) {
+        cp::KmpMatcher m(pattern);
+        std::vector<long long> ends;
+        for (size_t i = 0; i < text.size(); i += chunk) {
+            m.feed(std::string_view(text).substr(i, chunk),
+                   [&](long long end) { ends.push_back(end); });
+        }
+        EXPECT_EQ(ends, expected);
+    }
+}
+
+TEST_CASE(kmp_matcher_count_and_reset)
+{
+    cp::KmpMatcher m("aa");
+    EXPECT_EQ(m.count("a"), 0LL);
+    EXPECT_EQ(m.count("aa"), 2LL); // "a|a" across the boundary, then "aa"
+    m.reset();
+    EXPECT_EQ(m.count("a"), 0LL);
+    EXPECT_EQ(m.pos, 1LL);
+}
+
+TEST_CASE(kmp_matcher_assertions)
+{
+    EXPECT_ABORT(cp::KmpMatcher(""));
+}
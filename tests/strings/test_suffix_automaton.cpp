@@ -0,0 +1,129 @@
+#include "../framework/test_framework.hpp"
+#include "cp/strings/suffix_automaton.hpp"
+
+static long long naive_distinct(const std::string &s)
+{
+    std::set<std::string> subs;
+    for (size_t i = 0; i < s.size(); i++) {
+        for (size_t j = i + 1; j <= s.size(); j++) {
+            subs.insert(s.substr(i, j - i));
+        }
+    }
+    return subs.size();
+}
+
+static int naive_occurrences(const std::string &s, const std::string &p)
+{
+    int cnt = 0;
+    for (size_t i = 0; i + p.size() <= s.size(); i++) {
+        cnt += s.compare(i, p.size(), p) == 0;
+    }
+    return cnt;
+}
+
+static int naive_lcs(const std::string &s, const std::string &t)
+{
+    int best = 0;
+    for (size_t i = 0; i < t.size(); i++) {
+        for (size_t j = i + 1; j <= t.size(); j++) {
+            if (s.find(t.substr(i, j - i)) != std::string::npos) {
+                best = std::max(best, (int)(j - i));
+            }
+        }
+    }
+    return best;
+}
+
+TEST_CASE(suffix_automaton_distinct_substrings)
+{
+    EXPECT_EQ(cp::SuffixAutomaton<>("abcbc").count_distinct(), 12LL);
+    EXPECT_EQ(cp::SuffixAutomaton<>("aaaa").count_distinct(), 4LL);
+    EXPECT_EQ(cp::SuffixAutomaton<>("").count_distinct(), 0LL);
+}
+
+TEST_CASE(suffix_automaton_state_bound)
+{
+    std::string s = "a" + std::string(60, 'b') + "c";
+    cp::SuffixAutomaton<> sam(s);
+    EXPECT_TRUE(sam.size() <= 2 * (int)s.size());
+}
+
+TEST_CASE(suffix_automaton_occurrences)
+{
+    cp::SuffixAutomaton<> sam("abababa");
+    sam.compute_occurrences();
+    EXPECT_EQ(sam.occurrences("a"), 4);
+    EXPECT_EQ(sam.occurrences("aba"), 3);
+    EXPECT_EQ(sam.occurrences("abababa"), 1);
+    EXPECT_EQ(sam.occurrences("bb"), 0);
+    EXPECT_TRUE(sam.contains("bab"));
+    EXPECT_FALSE(sam.contains("abb"));
+}
+
+TEST_CASE(suffix_automaton_lcs)
+{
+    cp::SuffixAutomaton<> sam("xabcdey");
+    auto [len, start] = sam.lcs("zzbcdezz");
+    EXPECT_EQ(len, 4);
+    EXPECT_EQ(start, 2);
+    EXPECT_EQ(sam.lcs("qqq"), (std::pair<int, int>{0, 0}));
+}
+
+TEST_CASE(suffix_automaton_dense_promotion)
+{
+    // every letter follows 'a', so the root and state "a" exceed the inline capacity
+    std::string s;
+    for (char c = 'b'; c <= 'z'; c++) {
+        s += 'a';
+        s += c;
+    }
+    cp::SuffixAutomaton<> sam(s);
+    EXPECT_FALSE(sam.dense.empty());
+    EXPECT_EQ(sam.count_distinct(), naive_distinct(s));
+    sam.compute_occurrences();
+    EXPECT_EQ(sam.occurrences("a"), 25);
+    EXPECT_EQ(sam.occurrences("ak"), 1);
+    EXPECT_EQ(sam.occurrences("kal"), 1);
+}
+
+TEST_CASE(suffix_automaton_random_against_naive)
+{
+    std::mt19937 rng(6);
+    for (int iter = 0; iter < 100; iter++) {
+        int sigma = 1 + rng() % 8; // up to 8 symbols exercises both storage modes
+        std::string s(1 + rng() % 30, 'a'), t(1 + rng() % 30, 'a');
+        for (char &ch : s) {
+            ch = 'a' + rng() % sigma;
+        }
+        for (char &ch : t) {
+            ch = 'a' + rng() % sigma;
+        }
+        cp::SuffixAutomaton<8> sam(s);
+        EXPECT_EQ(sam.count_distinct(), naive_distinct(s));
+        sam.compute_occurrences();
+        for (int k = 0; k < 10; k++) {
+            size_t i = rng() % s.size();
+            std::string p = s.substr(i, 1 + rng() % 4);
+            EXPECT_EQ(sam.occurrences(p), naive_occurrences(s, p));
+        }
+        auto [len, start] = sam.lcs(t);
+        EXPECT_EQ(len, naive_lcs(s, t));
+        EXPECT_TRUE(s.find(t.substr(start, len)) != std::string::npos);
+    }
+}
+
+TEST_CASE(suffix_automaton_byte_alphabet)
+{
+    std::string s("\x00\xff\x80\x00\xff", 5);
+    cp::SuffixAutomaton<256, CHAR_MIN> sam(s);
+    sam.compute_occurrences();
+    EXPECT_EQ(sam.occurrences(std::string("\x00\xff", 2)), 2);
+    EXPECT_EQ(sam.count_distinct(), naive_distinct(s));
+}
+
+TEST_CASE(suffix_automaton_assertions)
+{
+    cp::SuffixAutomaton<> sam("abc");
+    EXPECT_ABORT(sam.occurrences("a")); // compute_occurrences() not called
+    EXPECT_ABORT(sam.extend('A'));
+}
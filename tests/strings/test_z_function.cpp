@@ -0,0 +1,48 @@
+#include "../framework/test_framework.hpp"
+#include "cp/strings/z_function.hpp"
+
+static std::vector<int> naive_z(const std::string &s)
+{
+    int n = s.size();
+    std::vector<int> z(n);
+    for (int i = 0; i < n; i++) {
+        while (i + z[i] < n && s[z[i]] == s[i + z[i]]) {
+            z[i]++;
+        }
+    }
+    return z;
+}
+
+TEST_CASE(z_function_basic)
+{
+    std::vector<int> expected = {7, 0, 1, 0, 3, 0, 1};
+    EXPECT_EQ(cp::z_function("abacaba"), expected);
+    EXPECT_EQ(cp::z_function("aaaa"), (std::vector<int>{4, 3, 2, 1}));
+    EXPECT_TRUE(cp::z_function("").empty());
+}
+
+TEST_CASE(z_function_reuses_caller_buffer)
+{
+    std::vector<int> buf(16, -1);
+    cp::z_function("abab", buf.data());
+    EXPECT_EQ(std::vector<int>(buf.begin(), buf.begin() + 4),
+              (std::vector<int>{4, 0, 2, 0}));
+    EXPECT_EQ(buf[4], -1); // nothing written past |s|
+    cp::z_function("zz", buf.data());
+    EXPECT_EQ(buf[0], 2);
+    EXPECT_EQ(buf[1], 1);
+}
+
+TEST_CASE(z_function_random_against_naive)
+{
+    std::mt19937 rng(3);
+    std::vector<int> buf(64);
+    for (int iter = 0; iter < 200; iter++) {
+        std::string s(rng() % 64, 'a');
+        for (char &ch : s) {
+            ch = 'a' + rng() % 2;
+        }
+        cp::z_function(s, buf.data());
+        EXPECT_EQ(std::vector<int>(buf.begin(), buf.begin() + s.size()), naive_z(s));
+    }
+}
@@ -1,27 +1,100 @@
+#include "framework/bench_baseline.hpp"
+#include "framework/bench_framework.hpp"
 #include "framework/test_framework.hpp"
+#include "framework/test_runner.hpp"
 #include <cstdlib>
 #include <iostream>
 
 using namespace std;
 
-int main()
+// If arg is "<name><value>", stores value and returns true.
+static bool flag(const string &arg, const string &name, string &value)
 {
-    auto &tests = cp_test::Registry();
-    int passed = 0;
-    int failed = 0;
+    if (arg.compare(0, name.size(), name) != 0) {
+        return false;
+    }
+    value = arg.substr(name.size());
+    return true;
+}
 
-    for (auto &tc : tests) {
-        try {
-            tc.fn();
-            cout << "[PASS] " << tc.name << "\n";
-            ++passed;
+// Usage:
+//   tests [flags]            run every TEST_CASE (flags in test_runner.hpp)
+//   tests --bench [flags]    run every BENCH_CASE (flags in bench_framework.hpp and
+//                            bench_baseline.hpp)
+int main(int argc, char **argv)
+{
+    bool bench = false;
+    cp_test::BenchOptions opt;
+    cp_test::TestOptions topt;
+    cp_test::BaselineOptions base;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i], v;
+        if (arg == "--bench") {
+            bench = true;
+        }
+        else if (flag(arg, "--filter=", v)) {
+            opt.filter = topt.filter = v;
+        }
+        else if (flag(arg, "--jobs=", v)) {
+            topt.jobs = max(0, stoi(v));
+        }
+        else if (flag(arg, "--timeout=", v)) {
+            topt.timeout = max(0.0, stod(v));
+        }
+        else if (flag(arg, "--slowest=", v)) {
+            topt.slowest = max(0, stoi(v));
+        }
+        else if (flag(arg, "--reps=", v)) {
+            opt.reps = max(1, stoi(v));
+        }
+        else if (flag(arg, "--warmup=", v)) {
+            opt.warmup = max(0, stoi(v));
+        }
+        else if (flag(arg, "--format=", v)) {
+            opt.format = v;
+        }
+        else if (flag(arg, "--out=", v)) {
+            opt.out = v;
         }
-        catch (const exception &e) {
-            cout << "[FAIL] " << tc.name << ": " << e.what() << "\n";
-            ++failed;
+        else if (arg == "--perf") {
+            opt.perf = true;
+        }
+        else if (flag(arg, "--save-baseline=", v)) {
+            base.save = v;
+        }
+        else if (flag(arg, "--baseline=", v)) {
+            base.compare = v;
+        }
+        else if (flag(arg, "--threshold=", v)) {
+            base.threshold = stod(v);
+        }
+        else if (flag(arg, "--alpha=", v)) {
+            base.alpha = stod(v);
+        }
+        else {
+            cerr << "unknown argument: " << arg << "\n";
+            return EXIT_FAILURE;
         }
     }
-
-    cout << "\n" << passed << "/" << (passed + failed) << " tests passed.\n";
-    return failed > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+    if (!bench) {
+        return cp_test::run_tests(topt);
+    }
+    // The baseline is read before running, so a missing file fails fast and the same
+    // path can be compared against and then overwritten in one run.
+    map<string, cp_test::BenchResult> baseline;
+    if (!base.compare.empty() && !cp_test::load_baseline(base.compare, baseline)) {
+        cerr << "cannot read baseline " << base.compare << "\n";
+        return EXIT_FAILURE;
+    }
+    vector<cp_test::BenchResult> results;
+    int status = cp_test::run_benchmarks(opt, results);
+    if (!base.compare.empty()) {
+        int regressions = cp_test::compare_to_baseline(results, baseline, base);
+        status = regressions > 0 ? EXIT_FAILURE : status;
+    }
+    if (!base.save.empty() && !cp_test::save_baseline(base.save, results)) {
+        cerr << "cannot write baseline " << base.save << "\n";
+        status = EXIT_FAILURE;
+    }
+    return status;
 }
@@ -0,0 +1,600 @@
+// bundle - inlines a program's quoted #includes into one self-contained source file and
+// strips library structs and aliases the program never names.
+//
+// Usage:
+//   bundle [-I dir]... [-o out.cpp] [--keep-comments] [--no-strip] main.cpp
+//   make bundle SRC=main.cpp OUT=main.bundled.cpp
+//
+// How it works:
+//   1. Inlining. Each `#include "path"` is resolved against the including file's
+//      directory, then against every -I dir (default: include), and replaced by the
+//      file's contents, recursively, like the preprocessor would. A file is inlined at
+//      most once and its `#pragma once` is dropped, so #pragma once headers dedupe
+//      exactly as they do when compiled. Quoted includes that resolve nowhere and
+//      <system> includes stay as they are; a <system> include repeated outside any
+//      #if block is dropped. Files found under a -I dir are library code.
+//   2. Stripping. Library text is split into namespace-scope items - everything at a
+//      brace depth where all enclosing braces belong to namespaces: a class, alias,
+//      function, variable or preprocessor line, each with the comments before it.
+//      struct / class definitions (with any template<...> prefix, forward declarations
+//      and specializations) and `using Name = ...` aliases are strippable, keyed by
+//      the name they declare. Every identifier of the program and of every other item
+//      is a use; a strippable item is kept if its name is used, which adds its own
+//      identifiers, until nothing changes. Names are compared as plain identifiers,
+//      so a member or local that shares a struct's name keeps the struct: stripping
+//      errs on the side of keeping code. Functions, variables, enums and macros are
+//      always kept.
+//   3. Compaction. Comments, blank lines and trailing spaces are removed (comments and
+//      single blank lines stay with --keep-comments).
+//
+// The lexer knows comments, string and character literals (with prefixes and raw
+// strings), digit separators (1'000'000) and preprocessor lines with continuations;
+// that is all the structure the steps above need.
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+namespace fs = std::filesystem;
+
+enum class Tok
+{
+    Space,   // spaces, tabs and backslash-newlines
+    Newline,
+    Comment,
+    Ident,
+    Number,
+    Literal, // string or character literal
+    Punct,
+};
+
+struct Token
+{
+    Tok kind;
+    string text;
+    bool pp = false; // part of a preprocessor line
+};
+
+static bool ident_char(char c)
+{
+    return isalnum((unsigned char)c) || c == '_';
+}
+
+// Splits src into tokens whose texts concatenate back to src.
+static vector<Token> lex(const string &src)
+{
+    vector<Token> out;
+    size_t i = 0, n = src.size();
+    bool line_start = true, pp = false;
+    auto push = [&](Tok kind, size_t from) {
+        out.push_back({kind, src.substr(from, i - from), pp});
+    };
+    while (i < n) {
+        size_t from = i;
+        char c = src[i];
+        if (c == '\n') {
+            i++;
+            push(Tok::Newline, from);
+            line_start = true, pp = false;
+            continue;
+        }
+        bool continuation = c == '\\' && i + 1 < n && src[i + 1] == '\n';
+        if (c == ' ' || c == '\t' || c == '\r' || continuation) {
+            i += continuation ? 2 : 1;
+            push(Tok::Space, from);
+            continue;
+        }
+        if (c == '#' && line_start) {
+            pp = true;
+        }
+        line_start = false;
+        if (c == '/' && i + 1 < n && src[i + 1] == '/') {
+            while (i < n && src[i] != '\n') {
+                i++;
+            }
+            push(Tok::Comment, from);
+        }
+        else if (c == '/' && i + 1 < n && src[i + 1] == '*') {
+            size_t end = src.find("*/", i + 2);
+            i = end == string::npos ? n : end + 2;
+            push(Tok::Comment, from);
+        }
+        else if (isdigit((unsigned char)c) ||
+                 (c == '.' && i + 1 < n && isdigit((unsigned char)src[i + 1]))) {
+            // pp-number: digits, letters, dots, separators, exponent signs
+            while (i < n && (ident_char(src[i]) || src[i] == '.' ||
+                             (src[i] == '\'' && i + 1 < n && ident_char(src[i + 1])) ||
+                             ((src[i] == '+' || src[i] == '-') &&
+                              strchr("eEpP", src[i - 1])))) {
+                i++;
+            }
+            push(Tok::Number, from);
+        }
+        else if (ident_char(c)) {
+            while (i < n && ident_char(src[i])) {
+                i++;
+            }
+            string word = src.substr(from, i - from);
+            bool prefix = word == "R" || word == "u8R" || word == "uR" ||
+                          word == "UR" || word == "LR";
+            if (i < n && src[i] == '"' && prefix) { // raw string R"delim( ... )delim"
+                size_t open = src.find('(', i);
+                string close = ")" + src.substr(i + 1, open - i - 1) + "\"";
+                size_t end = src.find(close, open);
+                i = end == string::npos ? n : end + close.size();
+                push(Tok::Literal, from);
+            }
+            else if (i < n && (src[i] == '"' || src[i] == '\'') &&
+                     (word == "u8" || word == "u" || word == "U" || word == "L")) {
+                char q = src[i++];
+                while (i < n && src[i] != q && src[i] != '\n') {
+                    i += src[i] == '\\' ? 2 : 1;
+                }
+                i = min(i + 1, n);
+                push(Tok::Literal, from);
+            }
+            else {
+                push(Tok::Ident, from);
+            }
+        }
+        else if (c == '"' || c == '\'') {
+            i++;
+            while (i < n && src[i] != c && src[i] != '\n') {
+                i += src[i] == '\\' ? 2 : 1;
+            }
+            i = min(i + 1, n);
+            push(Tok::Literal, from);
+        }
+        else {
+            i++;
+            push(Tok::Punct, from);
+        }
+    }
+    return out;
+}
+
+// A run of inlined text from one file.
+struct Chunk
+{
+    string text;
+    bool library;
+};
+
+class Inliner
+{
+public:
+    Inliner(vector<fs::path> dirs) : include_dirs(std::move(dirs)) {}
+
+    // Appends file's text, with its includes expanded, to chunks.
+    bool expand(const fs::path &file, bool library)
+    {
+        fs::path canon = fs::weakly_canonical(file);
+        if (!seen_files.insert(canon).second) {
+            return true;
+        }
+        ifstream in(file);
+        if (!in) {
+            cerr << "bundle: cannot read " << file << "\n";
+            return false;
+        }
+        string line, text;
+        int if_depth = 0;
+        auto flush = [&] {
+            if (!text.empty()) {
+                chunks.push_back({text, library});
+                text.clear();
+            }
+        };
+        while (getline(in, line)) {
+            string d = directive(line);
+            if (d.rfind("if", 0) == 0) {
+                if_depth++;
+            }
+            else if (d.rfind("endif", 0) == 0) {
+                if_depth--;
+            }
+            if (d == "pragma once") {
+                continue;
+            }
+            if (d.rfind("include", 0) == 0) {
+                string arg = d.substr(7);
+                arg.erase(0, arg.find_first_not_of(" \t"));
+                if (arg.size() > 2 && arg[0] == '<') {
+                    if (if_depth == 0 && !seen_system.insert(arg).second) {
+                        continue;
+                    }
+                }
+                else if (arg.size() > 2 && arg[0] == '"') {
+                    string name = arg.substr(1, arg.find('"', 1) - 1);
+                    bool lib = false;
+                    fs::path found = resolve(file.parent_path(), name, lib);
+                    if (!found.empty()) {
+                        flush();
+                        if (!expand(found, library || lib)) {
+                            return false;
+                        }
+                        continue;
+                    }
+                }
+            }
+            text += line + "\n";
+        }
+        flush();
+        return true;
+    }
+
+    vector<Chunk> chunks;
+
+private:
+    // The directive of a preprocessor line without '#' and with single spaces after
+    // its keyword ("include <x>", "pragma once"), or "" for other lines.
+    static string directive(const string &line)
+    {
+        size_t i = line.find_first_not_of(" \t");
+        if (i == string::npos || line[i] != '#') {
+            return "";
+        }
+        i = line.find_first_not_of(" \t", i + 1);
+        if (i == string::npos) {
+            return "";
+        }
+        string rest = line.substr(i);
+        while (!rest.empty() && isspace((unsigned char)rest.back())) {
+            rest.pop_back();
+        }
+        size_t kw = rest.find_first_of(" \t<\"");
+        if (kw != string::npos) {
+            size_t arg = rest.find_first_not_of(" \t", kw);
+            rest = rest.substr(0, kw) + " " + rest.substr(arg);
+        }
+        return rest;
+    }
+
+    // Resolves a quoted include like the preprocessor: the includer's directory first,
+    // then the -I dirs. Sets lib when the file came from a -I dir.
+    fs::path resolve(const fs::path &from, const string &name, bool &lib) const
+    {
+        if (fs::path p = from / name; fs::is_regular_file(p)) {
+            lib = under_include_dir(p);
+            return p;
+        }
+        for (auto &dir : include_dirs) {
+            if (fs::path p = dir / name; fs::is_regular_file(p)) {
+                lib = true;
+                return p;
+            }
+        }
+        return {};
+    }
+
+    bool under_include_dir(const fs::path &p) const
+    {
+        string canon = fs::weakly_canonical(p).string();
+        for (auto &dir : include_dirs) {
+            string d = fs::weakly_canonical(dir).string() + "/";
+            if (canon.compare(0, d.size(), d) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    vector<fs::path> include_dirs;
+    set<fs::path> seen_files;
+    set<string> seen_system;
+};
+
+// A namespace-scope item of a library chunk: tokens [begin, end), leading comments and
+// whitespace included.
+struct Item
+{
+    size_t chunk, begin, end;
+    string name; // declared name if strippable, else ""
+    set<string> idents;
+};
+
+class Stripper
+{
+public:
+    // Splits a library chunk into items (see the header comment). Declarations consume
+    // their own braces, so between items the scan is always at namespace scope and a
+    // '}' there closes a namespace.
+    void split(size_t chunk, const vector<Token> &toks)
+    {
+        size_t i = 0, n = toks.size();
+        auto significant = [&](size_t k) {
+            return toks[k].kind != Tok::Space && toks[k].kind != Tok::Newline &&
+                   toks[k].kind != Tok::Comment;
+        };
+        auto next_sig = [&](size_t k) {
+            while (k < n && !significant(k)) {
+                k++;
+            }
+            return k;
+        };
+        while (i < n) {
+            size_t begin = i, k = next_sig(i);
+            if (k == n) {
+                break; // trailing comments and whitespace: kept with the chunk
+            }
+            Item item{chunk, begin, 0, "", {}};
+            if (toks[k].pp) { // preprocessor line
+                while (k < n && toks[k].kind != Tok::Newline) {
+                    collect(item, toks[k++]);
+                }
+                item.end = k;
+            }
+            else if (toks[k].text == "}") { // closes the enclosing namespace
+                item.end = k + 1;
+            }
+            else if (toks[k].text == "namespace" ||
+                     is_extern_block(toks, k, next_sig)) {
+                while (k < n && toks[k].text != "{" && toks[k].text != ";") {
+                    collect(item, toks[k++]);
+                }
+                item.end = min(k + 1, n);
+            }
+            else {
+                item.end = declaration(toks, k, next_sig, item);
+            }
+            items.push_back(item);
+            i = item.end;
+        }
+    }
+
+    // Marks the items to keep given the identifiers the program uses; returns the
+    // number of items dropped.
+    int resolve(const set<string> &program_idents)
+    {
+        set<string> used = program_idents;
+        for (auto &it : items) {
+            if (it.name.empty()) {
+                used.insert(it.idents.begin(), it.idents.end());
+            }
+        }
+        keep.assign(items.size(), false);
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (size_t k = 0; k < items.size(); k++) {
+                if (!keep[k] && (items[k].name.empty() || used.count(items[k].name))) {
+                    keep[k] = changed = true;
+                    used.insert(items[k].idents.begin(), items[k].idents.end());
+                }
+            }
+        }
+        return count(keep.begin(), keep.end(), false);
+    }
+
+    // True unless token tok of chunk falls inside a dropped item.
+    bool kept(size_t chunk, size_t tok) const
+    {
+        auto it = upper_bound(items.begin(),
+                              items.end(),
+                              make_pair(chunk, tok),
+                              [](const pair<size_t, size_t> &p, const Item &x) {
+                                  return p < make_pair(x.chunk, x.end);
+                              });
+        return it == items.end() || it->chunk != chunk || tok < it->begin ||
+               keep[it - items.begin()];
+    }
+
+private:
+    static void collect(Item &item, const Token &t)
+    {
+        if (t.kind == Tok::Ident) {
+            item.idents.insert(t.text);
+        }
+    }
+
+    template <typename NextSig>
+    static bool is_extern_block(const vector<Token> &toks, size_t k, NextSig &next_sig)
+    {
+        if (toks[k].text != "extern") {
+            return false;
+        }
+        size_t a = next_sig(k + 1), b = a < toks.size() ? next_sig(a + 1) : a;
+        return a < toks.size() && toks[a].kind == Tok::Literal && b < toks.size() &&
+               toks[b].text == "{";
+    }
+
+    // Scans the declaration starting at significant token k, fills item's name and
+    // identifiers, and returns the index one past its last token.
+    template <typename NextSig>
+    static size_t declaration(const vector<Token> &toks, size_t k, NextSig &next_sig,
+                              Item &item)
+    {
+        size_t n = toks.size();
+        // Skip template<...> prefixes to find the declaration's first keyword.
+        size_t head = k;
+        while (head < n && toks[head].text == "template") {
+            head = next_sig(head + 1);
+            for (int angle = 0; head < n; head = next_sig(head + 1)) {
+                angle += toks[head].text == "<" ? 1 : toks[head].text == ">" ? -1 : 0;
+                if (angle == 0) {
+                    head = next_sig(head + 1);
+                    break;
+                }
+            }
+        }
+        bool ends_at_semicolon = false;
+        if (head < n && (toks[head].text == "struct" || toks[head].text == "class")) {
+            ends_at_semicolon = true;
+            size_t name = next_sig(head + 1);
+            while (name < n && toks[name].text == "[") { // [[attributes]]
+                for (int depth = 0; name < n; name = next_sig(name + 1)) {
+                    const string &t = toks[name].text;
+                    depth += t == "[" ? 1 : t == "]" ? -1 : 0;
+                    if (depth == 0) {
+                        break;
+                    }
+                }
+                name = next_sig(name + 1);
+            }
+            if (name < n && toks[name].kind == Tok::Ident) {
+                item.name = toks[name].text;
+            }
+        }
+        else if (head < n &&
+                 (toks[head].text == "union" || toks[head].text == "enum")) {
+            ends_at_semicolon = true; // ends at ';' but is never stripped
+        }
+        else if (head < n && toks[head].text == "using") {
+            size_t name = next_sig(head + 1), eq = name < n ? next_sig(name + 1) : n;
+            if (name < n && toks[name].kind == Tok::Ident && eq < n &&
+                toks[eq].text == "=") {
+                item.name = toks[name].text;
+                ends_at_semicolon = true; // the type may hold braces: plus<ll>{}
+            }
+        }
+        // The declaration ends at a ';' outside braces, or for anything but a class or
+        // alias at the '}' closing its body (functions, namespace-scope lambdas).
+        int depth = 0;
+        for (; k < n; k++) {
+            collect(item, toks[k]);
+            if (toks[k].kind != Tok::Punct) {
+                continue;
+            }
+            if (toks[k].text == "{") {
+                depth++;
+            }
+            else if (toks[k].text == "}" && --depth == 0 && !ends_at_semicolon) {
+                return k + 1;
+            }
+            else if (toks[k].text == ";" && depth == 0) {
+                return k + 1;
+            }
+        }
+        return n;
+    }
+
+    vector<Item> items; // in (chunk, position) order
+    vector<bool> keep;
+};
+
+// Concatenates tokens, dropping comments unless asked, then blank lines (all of them,
+// or runs of more than one with keep_comments) and trailing whitespace.
+static string render(const vector<string> &pieces, bool keep_comments)
+{
+    string joined;
+    for (auto &p : pieces) {
+        joined += p;
+    }
+    istringstream in(joined);
+    string line, out;
+    bool blank = true;
+    while (getline(in, line)) {
+        while (!line.empty() && isspace((unsigned char)line.back())) {
+            line.pop_back();
+        }
+        if (line.empty()) {
+            if (keep_comments && !blank) {
+                out += "\n";
+            }
+            blank = true;
+            continue;
+        }
+        out += line + "\n";
+        blank = false;
+    }
+    return out;
+}
+
+int main(int argc, char **argv)
+{
+    vector<fs::path> dirs;
+    string input, output;
+    bool keep_comments = false, strip = true;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "-I" && i + 1 < argc) {
+            dirs.push_back(argv[++i]);
+        }
+        else if (arg.rfind("-I", 0) == 0 && arg.size() > 2) {
+            dirs.push_back(arg.substr(2));
+        }
+        else if (arg == "-o" && i + 1 < argc) {
+            output = argv[++i];
+        }
+        else if (arg == "--keep-comments") {
+            keep_comments = true;
+        }
+        else if (arg == "--no-strip") {
+            strip = false;
+        }
+        else if (input.empty() && arg[0] != '-') {
+            input = arg;
+        }
+        else {
+            cerr << "usage: bundle [-I dir]... [-o out.cpp] [--keep-comments] "
+                    "[--no-strip] main.cpp\n";
+            return 1;
+        }
+    }
+    if (input.empty()) {
+        cerr << "bundle: no input file\n";
+        return 1;
+    }
+    if (dirs.empty()) {
+        dirs.push_back("include");
+    }
+
+    Inliner inliner(dirs);
+    if (!inliner.expand(input, false)) {
+        return 1;
+    }
+    vector<vector<Token>> toks;
+    set<string> program_idents;
+    Stripper stripper;
+    for (size_t c = 0; c < inliner.chunks.size(); c++) {
+        toks.push_back(lex(inliner.chunks[c].text));
+        if (inliner.chunks[c].library) {
+            if (strip) {
+                stripper.split(c, toks[c]);
+            }
+        }
+        else {
+            for (auto &t : toks[c]) {
+                if (t.kind == Tok::Ident) {
+                    program_idents.insert(t.text);
+                }
+            }
+        }
+    }
+    int dropped = stripper.resolve(program_idents);
+
+    vector<string> pieces;
+    for (size_t c = 0; c < toks.size(); c++) {
+        for (size_t k = 0; k < toks[c].size(); k++) {
+            const Token &t = toks[c][k];
+            if (!stripper.kept(c, k)) {
+                continue;
+            }
+            if (t.kind == Tok::Comment && !keep_comments) {
+                // a removed /* */ comment still separates the tokens around it
+                pieces.push_back(t.text[1] == '*' ? " " : "");
+            }
+            else {
+                pieces.push_back(t.text);
+            }
+        }
+    }
+    string result = render(pieces, keep_comments);
+    if (output.empty()) {
+        cout << result;
+    }
+    else if (!(ofstream(output) << result)) {
+        cerr << "bundle: cannot write " << output << "\n";
+        return 1;
+    }
+    cerr << "bundle: " << inliner.chunks.size() << " chunks, " << dropped
+         << " unused declarations dropped, " << result.size() << " bytes\n";
+    return 0;
+}